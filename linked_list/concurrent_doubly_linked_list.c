@@ -0,0 +1,623 @@
+// 컴파일: gcc -O2 -pthread concurrent_doubly_linked_list.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+/*
+ * 세밀한 락(fine-grained locking)을 쓰는 이중 연결 리스트
+ *  - 노드마다 락을 두고, 쓰기 연산은 앞 노드를 잡은 채 다음 노드를 잡는 hand-over-hand 방식으로 이동
+ *  - 락은 항상 왼쪽(head 쪽)에서 오른쪽 순서로 잡으므로 교착 상태가 생기지 않음
+ *  - search는 락을 잡지 않고 기다리지도 않음: next와 removed를 원자적으로 읽기만 하며, data는 연결된 뒤 바뀌지 않음
+ *  - 떼어낸 노드는 에포크 기반 회수(epoch-based reclamation)로 해제:
+ *    락 없이 노드를 따라가는 search/append는 현재 에포크를 알린 채 동작하고,
+ *    떼어낸 노드는 스레드별 목록에 모았다가 에포크가 두 번 오른 뒤 해제
+ *    (에포크는 RETIRE_THRESHOLD번 떼어낼 때마다 한 번 올려 보며, 그때만 락을 잡음)
+ */
+
+// 에포크 슬롯을 동시에 쓸 수 있는 최대 스레드 수
+#define MAX_THREADS 128
+// 떼어낸 노드를 에포크별로 모아 두는 목록 수 (현재, 한 에포크 전, 두 에포크 전)
+#define EPOCH_COUNT 3
+// 스레드가 이만큼 떼어낼 때마다 에포크를 올려 봄
+#define RETIRE_THRESHOLD 64
+
+// 동시 이중 연결 리스트의 노드를 나타내는 구조체
+typedef struct Node
+{
+  int data;                     // 노드에 저장된 데이터 (연결된 뒤에는 바뀌지 않음)
+  _Atomic(struct Node *) next;  // 다음 노드를 가리키는 포인터
+  _Atomic(struct Node *) prev;  // 이전 노드를 가리키는 포인터
+  pthread_mutex_t lock;         // 이 노드의 링크를 바꿀 때 잡는 락
+  atomic_int removed;           // 리스트에서 떼어냈으면 1
+  struct Node *retired_next;    // 떼어낸 노드 목록에서 다음 노드
+} Node;
+
+// 스레드 하나의 에포크 상태와 떼어낸 노드 목록 (거짓 공유를 막기 위해 캐시 라인 단위로 정렬)
+// 떼어낸 노드 목록은 이 슬롯을 가진 스레드만 건드린다.
+typedef struct EpochSlot
+{
+  _Alignas(64) atomic_uint epoch;        // 마지막으로 들어갈 때 본 에포크
+  atomic_int active;                     // 노드를 읽는 중이면 1
+  Node *retired[EPOCH_COUNT];            // 떼어낸 에포크별로 아직 해제하지 않은 노드 목록
+  unsigned retired_epoch[EPOCH_COUNT];   // retired[i]에 모인 노드를 떼어낸 에포크
+  int retired_count;                     // 해제를 기다리는 노드 수
+  int since_advance;                     // 마지막으로 에포크를 올려 본 뒤 떼어낸 노드 수
+} EpochSlot;
+
+// 동시 이중 연결 리스트를 나타내는 구조체
+// head와 tail은 데이터가 없는 경계 노드라, 모든 데이터 노드는 항상 앞뒤 노드를 가진다.
+typedef struct ConcurrentDoublyLinkedList
+{
+  Node head;                    // 시작 경계 노드 (head.next가 첫 노드)
+  Node tail;                    // 끝 경계 노드 (tail.prev가 마지막 노드)
+  atomic_int size;              // 노드 수
+  atomic_uint epoch;            // 현재 에포크 (epoch_lock을 잡은 채로만 증가)
+  pthread_mutex_t epoch_lock;   // 에포크를 올리는 스레드를 하나로 제한하는 락
+  EpochSlot slots[MAX_THREADS]; // 스레드별 에포크 상태와 떼어낸 노드 목록
+} ConcurrentDoublyLinkedList;
+
+atomic_int slot_in_use[MAX_THREADS]; // 슬롯을 어떤 스레드가 쓰고 있으면 1
+atomic_int thread_count = 0;         // 한 번이라도 쓰인 슬롯 수 (에포크 검사 범위)
+_Thread_local int thread_id = -1;
+
+// 노드 필드 초기화 함수
+void node_init(Node *node, int data)
+{
+  node->data = data;
+  atomic_init(&node->next, NULL);
+  atomic_init(&node->prev, NULL);
+  pthread_mutex_init(&node->lock, NULL);
+  atomic_init(&node->removed, 0);
+  node->retired_next = NULL;
+}
+
+// 리스트 초기화 함수 (초기화 후에는 리스트를 다른 곳으로 옮기면 안 됨)
+void init(ConcurrentDoublyLinkedList *list)
+{
+  node_init(&list->head, 0);
+  node_init(&list->tail, 0);
+  atomic_store(&list->head.next, &list->tail);
+  atomic_store(&list->tail.prev, &list->head);
+  atomic_init(&list->size, 0);
+  atomic_init(&list->epoch, 0);
+  pthread_mutex_init(&list->epoch_lock, NULL);
+  for (int t = 0; t < MAX_THREADS; t++)
+  {
+    EpochSlot *slot = &list->slots[t];
+    atomic_init(&slot->epoch, 0);
+    atomic_init(&slot->active, 0);
+    for (int e = 0; e < EPOCH_COUNT; e++)
+    {
+      slot->retired[e] = NULL;
+      slot->retired_epoch[e] = 0;
+    }
+    slot->retired_count = 0;
+    slot->since_advance = 0;
+  }
+}
+
+// 현재 스레드의 슬롯 번호를 돌려주는 함수 (처음 호출할 때 빈 슬롯을 배정)
+int current_thread_id(void)
+{
+  if (thread_id >= 0)
+  {
+    return thread_id;
+  }
+
+  for (int t = 0; t < MAX_THREADS; t++)
+  {
+    int expected = 0;
+    if (atomic_compare_exchange_strong(&slot_in_use[t], &expected, 1))
+    {
+      thread_id = t;
+      int seen = atomic_load(&thread_count);
+      while (seen <= t && !atomic_compare_exchange_weak(&thread_count, &seen, t + 1))
+      {
+      }
+      return t;
+    }
+  }
+  fprintf(stderr, "동시에 쓰는 스레드 수가 MAX_THREADS(%d)를 넘었습니다.\n", MAX_THREADS);
+  abort();
+}
+
+// 스레드가 리스트 사용을 마칠 때 호출하는 함수 (슬롯을 반납)
+// 아직 해제하지 못한 노드는 슬롯에 남아, 다음에 이 슬롯을 받는 스레드나 free_list가 해제한다.
+void thread_leave(void)
+{
+  if (thread_id < 0)
+  {
+    return;
+  }
+  atomic_store(&slot_in_use[thread_id], 0);
+  thread_id = -1;
+}
+
+// 락 없이 노드를 따라가기 전에 현재 에포크를 알리는 함수
+void epoch_enter(ConcurrentDoublyLinkedList *list)
+{
+  EpochSlot *slot = &list->slots[current_thread_id()];
+  atomic_store(&slot->epoch, atomic_load(&list->epoch));
+  atomic_store(&slot->active, 1);
+}
+
+// 노드를 다 읽은 뒤 호출하는 함수
+void epoch_exit(ConcurrentDoublyLinkedList *list)
+{
+  atomic_store(&list->slots[thread_id].active, 0);
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(ConcurrentDoublyLinkedList *list)
+{
+  return atomic_load(&list->size) == 0;
+}
+
+// pred와 succ(둘 다 잠겨 있음) 사이에 새 노드를 연결하는 함수
+void link_between(ConcurrentDoublyLinkedList *list, Node *pred, Node *succ, Node *node)
+{
+  atomic_store(&node->prev, pred);
+  atomic_store(&node->next, succ);
+  atomic_store(&pred->next, node);
+  atomic_store(&succ->prev, node);
+  atomic_fetch_add(&list->size, 1);
+}
+
+// 리스트의 끝에 새 노드를 추가하는 함수
+void append(ConcurrentDoublyLinkedList *list, int data)
+{
+  Node *new_node = (Node *)malloc(sizeof(Node));
+  node_init(new_node, data);
+
+  // tail.prev는 락 없이 읽으므로, 락을 잡기 전에 pred가 해제되지 않도록 에포크 안에서 진행
+  epoch_enter(list);
+  while (1)
+  {
+    // 마지막 노드 -> tail 순서로 잡은 뒤, 그 사이에 다른 스레드가 끼어들지 않았는지 확인
+    Node *pred = atomic_load(&list->tail.prev);
+    pthread_mutex_lock(&pred->lock);
+    pthread_mutex_lock(&list->tail.lock);
+    if (!atomic_load(&pred->removed) && atomic_load(&pred->next) == &list->tail)
+    {
+      link_between(list, pred, &list->tail, new_node);
+      pthread_mutex_unlock(&list->tail.lock);
+      pthread_mutex_unlock(&pred->lock);
+      epoch_exit(list);
+      return;
+    }
+    pthread_mutex_unlock(&list->tail.lock);
+    pthread_mutex_unlock(&pred->lock);
+  }
+}
+
+// 리스트의 시작에 새 노드를 추가하는 함수
+void prepend(ConcurrentDoublyLinkedList *list, int data)
+{
+  Node *new_node = (Node *)malloc(sizeof(Node));
+  node_init(new_node, data);
+
+  pthread_mutex_lock(&list->head.lock);
+  Node *succ = atomic_load(&list->head.next);
+  pthread_mutex_lock(&succ->lock);
+  link_between(list, &list->head, succ, new_node);
+  pthread_mutex_unlock(&succ->lock);
+  pthread_mutex_unlock(&list->head.lock);
+}
+
+// 노드 하나를 정리하고 해제하는 함수
+void destroy_node(Node *node)
+{
+  pthread_mutex_destroy(&node->lock);
+  free(node);
+}
+
+// 모든 활성 스레드가 현재 에포크를 보고 있으면 에포크를 하나 올리는 함수
+// 다른 스레드가 이미 올리는 중이면 기다리지 않고 돌아간다.
+void try_advance(ConcurrentDoublyLinkedList *list)
+{
+  if (pthread_mutex_trylock(&list->epoch_lock) != 0)
+  {
+    return;
+  }
+  unsigned epoch = atomic_load(&list->epoch);
+  int threads = atomic_load(&thread_count);
+  for (int t = 0; t < threads && t < MAX_THREADS; t++)
+  {
+    if (atomic_load(&list->slots[t].active) && atomic_load(&list->slots[t].epoch) != epoch)
+    {
+      pthread_mutex_unlock(&list->epoch_lock);
+      return;
+    }
+  }
+  atomic_store(&list->epoch, epoch + 1);
+  pthread_mutex_unlock(&list->epoch_lock);
+}
+
+// 슬롯의 목록 중 두 에포크 이상 지난 것을 해제하는 함수
+// 에포크 e에서 떼어낸 노드는 에포크가 e+2가 되면 해제할 수 있다. 그 사이 에포크가 e+1로 오르려면 에포크 안의 스레드가
+// 모두 e를 보고 있어야 하므로, e+2를 보는 스레드는 모두 노드를 떼어낸 뒤에 들어와 그 노드에 닿을 수 없다.
+void reclaim(ConcurrentDoublyLinkedList *list, EpochSlot *slot)
+{
+  unsigned epoch = atomic_load(&list->epoch);
+  for (int e = 0; e < EPOCH_COUNT; e++)
+  {
+    if (slot->retired[e] && epoch - slot->retired_epoch[e] >= 2)
+    {
+      Node *old = slot->retired[e];
+      slot->retired[e] = NULL;
+      while (old)
+      {
+        Node *next = old->retired_next;
+        destroy_node(old);
+        slot->retired_count--;
+        old = next;
+      }
+    }
+  }
+}
+
+// 떼어낸 노드를 현재 스레드의 목록에 모아 두는 함수 (RETIRE_THRESHOLD번마다 에포크를 올려 보고 정리)
+void retire(ConcurrentDoublyLinkedList *list, Node *node)
+{
+  EpochSlot *slot = &list->slots[current_thread_id()];
+  unsigned epoch = atomic_load(&list->epoch);
+  int index = epoch % EPOCH_COUNT;
+  if (slot->retired[index] && slot->retired_epoch[index] != epoch)
+  {
+    reclaim(list, slot); // 같은 자리를 쓰던 세 에포크 전 목록은 이미 해제할 수 있음
+  }
+  node->retired_next = slot->retired[index];
+  slot->retired[index] = node;
+  slot->retired_epoch[index] = epoch;
+  slot->retired_count++;
+
+  if (++slot->since_advance >= RETIRE_THRESHOLD)
+  {
+    slot->since_advance = 0;
+    try_advance(list);
+    reclaim(list, slot);
+  }
+}
+
+// 해제를 기다리는 노드 수를 반환하는 함수 (다른 스레드가 수정하지 않을 때 사용)
+int pending_nodes(ConcurrentDoublyLinkedList *list)
+{
+  int count = 0;
+  for (int t = 0; t < MAX_THREADS; t++)
+  {
+    count += list->slots[t].retired_count;
+  }
+  return count;
+}
+
+// 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수 (hand-over-hand)
+void delete(ConcurrentDoublyLinkedList *list, int data)
+{
+  Node *pred = &list->head;
+  pthread_mutex_lock(&pred->lock);
+  Node *current = atomic_load(&pred->next);
+  pthread_mutex_lock(&current->lock);
+
+  while (current != &list->tail)
+  {
+    if (current->data == data)
+    {
+      Node *succ = atomic_load(&current->next);
+      pthread_mutex_lock(&succ->lock);
+      atomic_store(&current->removed, 1); // current->next는 그대로 두어 읽는 스레드가 계속 진행할 수 있게 함
+      atomic_store(&pred->next, succ);
+      atomic_store(&succ->prev, pred);
+      atomic_fetch_sub(&list->size, 1);
+      pthread_mutex_unlock(&succ->lock);
+      pthread_mutex_unlock(&current->lock);
+      pthread_mutex_unlock(&pred->lock);
+      retire(list, current);
+      return;
+    }
+
+    // 앞 노드를 놓고 한 칸 이동 (current는 잡은 채 다음 노드를 잡음)
+    Node *next = atomic_load(&current->next);
+    pthread_mutex_unlock(&pred->lock);
+    pred = current;
+    current = next;
+    pthread_mutex_lock(&current->lock);
+  }
+
+  pthread_mutex_unlock(&current->lock);
+  pthread_mutex_unlock(&pred->lock);
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수 (락 없음, 재시도 없음)
+// 떼어낸 노드에 서 있어도 그 노드의 next를 따라가면 다시 리스트로 돌아오므로 처음부터 다시 시작하지 않는다.
+int search(ConcurrentDoublyLinkedList *list, int data)
+{
+  int found = 0;
+  epoch_enter(list);
+  Node *current = atomic_load(&list->head.next);
+  while (current != &list->tail)
+  {
+    if (current->data == data && !atomic_load(&current->removed))
+    {
+      found = 1;
+      break;
+    }
+    current = atomic_load(&current->next);
+  }
+  epoch_exit(list);
+  return found;
+}
+
+// 리스트의 내용을 출력하는 함수 (다른 스레드가 수정하지 않을 때 사용)
+void show(ConcurrentDoublyLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  Node *current = atomic_load(&list->head.next);
+  while (current != &list->tail)
+  {
+    printf("%d <-> ", current->data);
+    current = atomic_load(&current->next);
+  }
+  printf("NULL\n");
+}
+
+// 리스트의 노드 수를 반환하는 함수
+int length(ConcurrentDoublyLinkedList *list)
+{
+  return atomic_load(&list->size);
+}
+
+// 메모리 해제 함수 (모든 스레드가 끝난 뒤 호출)
+// 리스트의 노드와 그동안 떼어낸 노드를 함께 해제한다.
+void free_list(ConcurrentDoublyLinkedList *list)
+{
+  Node *current = atomic_load(&list->head.next);
+  while (current != &list->tail)
+  {
+    Node *next = atomic_load(&current->next);
+    destroy_node(current);
+    current = next;
+  }
+  for (int t = 0; t < MAX_THREADS; t++)
+  {
+    EpochSlot *slot = &list->slots[t];
+    for (int e = 0; e < EPOCH_COUNT; e++)
+    {
+      while (slot->retired[e])
+      {
+        Node *next = slot->retired[e]->retired_next;
+        destroy_node(slot->retired[e]);
+        slot->retired[e] = next;
+      }
+    }
+    slot->retired_count = 0;
+    slot->since_advance = 0;
+  }
+  atomic_store(&list->head.next, &list->tail);
+  atomic_store(&list->tail.prev, &list->head);
+  atomic_store(&list->size, 0);
+}
+
+// 비교용: 기존 이중 연결 리스트 전체를 뮤텍스 하나로 감싼 리스트
+typedef struct PlainNode
+{
+  int data;
+  struct PlainNode *next;
+  struct PlainNode *prev;
+} PlainNode;
+
+typedef struct MutexDoublyLinkedList
+{
+  pthread_mutex_t lock;
+  PlainNode *head;
+  PlainNode *tail;
+} MutexDoublyLinkedList;
+
+void mutex_init(MutexDoublyLinkedList *list)
+{
+  pthread_mutex_init(&list->lock, NULL);
+  list->head = NULL;
+  list->tail = NULL;
+}
+
+void mutex_append(MutexDoublyLinkedList *list, int data)
+{
+  PlainNode *new_node = (PlainNode *)malloc(sizeof(PlainNode));
+  new_node->data = data;
+  new_node->next = NULL;
+  pthread_mutex_lock(&list->lock);
+  new_node->prev = list->tail;
+  if (list->tail)
+  {
+    list->tail->next = new_node;
+  }
+  else
+  {
+    list->head = new_node;
+  }
+  list->tail = new_node;
+  pthread_mutex_unlock(&list->lock);
+}
+
+void mutex_delete(MutexDoublyLinkedList *list, int data)
+{
+  pthread_mutex_lock(&list->lock);
+  PlainNode *current = list->head;
+  while (current && current->data != data)
+  {
+    current = current->next;
+  }
+  if (current)
+  {
+    if (current->prev)
+      current->prev->next = current->next;
+    else
+      list->head = current->next;
+    if (current->next)
+      current->next->prev = current->prev;
+    else
+      list->tail = current->prev;
+    free(current);
+  }
+  pthread_mutex_unlock(&list->lock);
+}
+
+int mutex_search(MutexDoublyLinkedList *list, int data)
+{
+  pthread_mutex_lock(&list->lock);
+  PlainNode *current = list->head;
+  while (current && current->data != data)
+  {
+    current = current->next;
+  }
+  pthread_mutex_unlock(&list->lock);
+  return current != NULL;
+}
+
+void mutex_free(MutexDoublyLinkedList *list)
+{
+  while (list->head)
+  {
+    PlainNode *next = list->head->next;
+    free(list->head);
+    list->head = next;
+  }
+  list->tail = NULL;
+  pthread_mutex_destroy(&list->lock);
+}
+
+// 벤치마크에서 스레드 하나가 맡는 일
+typedef struct Worker
+{
+  ConcurrentDoublyLinkedList *fine;  // 세밀한 락 리스트 (NULL이면 coarse 사용)
+  MutexDoublyLinkedList *coarse;     // 전역 뮤텍스 리스트
+  int ops;                           // 수행할 연산 수
+  int read_percent;                  // search 비율 (나머지는 delete/append 반반)
+  int key_range;
+  unsigned seed;
+  long found;
+} Worker;
+
+void *worker(void *arg)
+{
+  Worker *w = (Worker *)arg;
+  unsigned state = w->seed;
+  for (int i = 0; i < w->ops; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    int key = (int)(state % (unsigned)w->key_range);
+    int op = (int)((state >> 16) % 100);
+    if (op < w->read_percent)
+    {
+      w->found += w->fine ? search(w->fine, key) : mutex_search(w->coarse, key);
+    }
+    else if (op % 2 == 0)
+    {
+      if (w->fine)
+        delete (w->fine, key);
+      else
+        mutex_delete(w->coarse, key);
+    }
+    else
+    {
+      if (w->fine)
+        append(w->fine, key);
+      else
+        mutex_append(w->coarse, key);
+    }
+  }
+  thread_leave();
+  return NULL;
+}
+
+double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 같은 연산 순서로 두 리스트의 처리량(초당 연산 수)을 측정
+void benchmark(int read_percent, int threads, int total_ops)
+{
+  int key_range = 512;
+  double seconds[2];
+  int pending = 0;
+  for (int fine = 1; fine >= 0; fine--)
+  {
+    ConcurrentDoublyLinkedList fine_list;
+    MutexDoublyLinkedList coarse_list;
+    init(&fine_list);
+    mutex_init(&coarse_list);
+    for (int k = 0; k < key_range; k += 2)
+    {
+      if (fine)
+        append(&fine_list, k);
+      else
+        mutex_append(&coarse_list, k);
+    }
+
+    pthread_t tids[64];
+    Worker workers[64];
+    double start = now_seconds();
+    for (int t = 0; t < threads; t++)
+    {
+      workers[t] = (Worker){fine ? &fine_list : NULL, &coarse_list, total_ops / threads, read_percent, key_range, 2463534242u + t * 7919u, 0};
+      pthread_create(&tids[t], NULL, worker, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++)
+    {
+      pthread_join(tids[t], NULL);
+    }
+    seconds[fine] = now_seconds() - start;
+    if (fine)
+    {
+      pending = pending_nodes(&fine_list);
+    }
+
+    free_list(&fine_list);
+    mutex_free(&coarse_list);
+  }
+  printf("읽기 %d%% %2d스레드: 세밀한 락 초당 %.1f만 회, 전역 뮤텍스 초당 %.1f만 회 (해제 대기 노드 %d개)\n",
+         read_percent, threads, total_ops / seconds[1] / 10000, total_ops / seconds[0] / 10000, pending);
+}
+
+// 사용 예제
+int main()
+{
+  ConcurrentDoublyLinkedList dll;
+  init(&dll);
+  append(&dll, 10);
+  append(&dll, 20);
+  append(&dll, 30);
+  show(&dll);
+  prepend(&dll, 5);
+  show(&dll);
+  delete (&dll, 20);
+  show(&dll);
+  printf("10 검색: %d\n", search(&dll, 10));
+  printf("20 검색: %d\n", search(&dll, 20));
+  printf("리스트 길이: %d\n", length(&dll));
+  free_list(&dll);
+
+  // 읽기 위주(95/5)와 쓰기 위주(50/50) 작업에서 전역 뮤텍스와 비교
+  int total_ops = 100000;
+  for (int threads = 1; threads <= 8; threads *= 2)
+  {
+    benchmark(95, threads, total_ops);
+  }
+  for (int threads = 1; threads <= 8; threads *= 2)
+  {
+    benchmark(50, threads, total_ops);
+  }
+  return 0;
+}
@@ -0,0 +1,536 @@
+// 컴파일: gcc -O2 -pthread concurrent_queue.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/*
+ * 연결 리스트 기반 락 프리 큐
+ *  - 노드는 큐를 만들 때 한 배열로 미리 할당하고, 큐와 free list 사이를 돌며 재사용됨 (enqueue/dequeue 중 malloc 없음)
+ *  - 링크는 포인터 대신 "노드 번호 + 태그"를 64비트 하나에 묶어 저장 (재사용된 노드로 인한 ABA 문제를 태그로 막음)
+ *  - QUEUE_MPMC: Michael-Scott 큐. 여러 생산자와 여러 소비자가 CAS로 동시에 사용
+ *  - QUEUE_MPSC: Vyukov 큐. 소비자는 하나만 허용하고, 생산자는 CAS 재시도 없이 끝남(대기 없음)
+ *    노드를 생산자 슬롯마다 고정으로 나눠 두고, 생산자는 자기 노드 캐시에서 꺼내 exchange 한 번으로 연결하며,
+ *    소비자는 다 쓴 노드를 주인 슬롯의 캐시(단일 생산자/단일 소비자 링)로 돌려줌
+ *    따라서 생산자 하나가 한 번에 넣어 둘 수 있는 데이터는 약 capacity / MAX_PRODUCERS개
+ */
+
+// 링크가 가리키는 노드가 없음을 나타내는 번호
+#define NIL UINT32_MAX
+// MPSC 모드에서 동시에 쓸 수 있는 최대 생산자 수
+#define MAX_PRODUCERS 16
+
+// 큐 동작 방식
+typedef enum QueueMode
+{
+  QUEUE_MPMC, // 다중 생산자 / 다중 소비자 (Michael-Scott)
+  QUEUE_MPSC  // 다중 생산자 / 단일 소비자 (Vyukov)
+} QueueMode;
+
+// 큐의 노드를 나타내는 구조체
+typedef struct Node
+{
+  _Atomic int data;           // 노드에 저장된 데이터
+  _Atomic uint64_t next;      // 큐에서 다음 노드: 태그(상위 32비트) | 번호(하위 32비트)
+  _Atomic uint32_t free_next; // free list에서 다음 노드 번호
+  uint32_t owner;             // MPSC 모드에서 이 노드를 가진 생산자 슬롯 (바뀌지 않음)
+} Node;
+
+// MPSC 생산자 슬롯 하나의 노드 캐시 (소비자만 채우고 그 슬롯의 생산자만 꺼내는 링)
+// 슬롯이 가진 노드 수만큼의 크기라 가득 차는 일이 없다.
+typedef struct NodeCache
+{
+  _Alignas(64) _Atomic uint32_t head; // 생산자가 다음에 꺼낼 위치
+  _Alignas(64) _Atomic uint32_t tail; // 소비자가 다음에 채울 위치
+  _Atomic uint32_t *slots;            // 노드 번호 링
+  uint32_t size;                      // 이 슬롯이 가진 노드 수
+} NodeCache;
+
+// 락 프리 큐를 나타내는 구조체
+typedef struct ConcurrentQueue
+{
+  _Alignas(64) _Atomic uint64_t head;      // 더미 노드 (실제 첫 데이터는 head의 다음 노드)
+  _Alignas(64) _Atomic uint64_t tail;      // 마지막 노드
+  _Alignas(64) _Atomic uint64_t free_top;  // 재사용할 노드 스택의 top (태그 | 번호)
+  Node *nodes;                             // 노드 배열
+  int capacity;                            // 담을 수 있는 최대 데이터 수
+  QueueMode mode;
+  NodeCache caches[MAX_PRODUCERS];         // MPSC 모드의 생산자 슬롯별 노드 캐시
+} ConcurrentQueue;
+
+atomic_int producer_in_use[MAX_PRODUCERS]; // 슬롯을 어떤 생산자 스레드가 쓰고 있으면 1
+_Thread_local int producer_id = -1;
+
+// 태그와 노드 번호를 하나로 묶는 함수들
+uint64_t pack(uint32_t index, uint32_t tag)
+{
+  return ((uint64_t)tag << 32) | index;
+}
+
+uint32_t index_of(uint64_t link)
+{
+  return (uint32_t)link;
+}
+
+uint32_t tag_of(uint64_t link)
+{
+  return (uint32_t)(link >> 32);
+}
+
+// free list에서 노드 하나를 꺼내는 함수 (Treiber 스택, 비어 있으면 NIL)
+uint32_t free_pop(ConcurrentQueue *q)
+{
+  uint64_t top = atomic_load(&q->free_top);
+  while (index_of(top) != NIL)
+  {
+    uint32_t next = atomic_load(&q->nodes[index_of(top)].free_next);
+    if (atomic_compare_exchange_weak(&q->free_top, &top, pack(next, tag_of(top) + 1)))
+    {
+      return index_of(top);
+    }
+  }
+  return NIL;
+}
+
+// 노드를 free list로 돌려보내는 함수
+void free_push(ConcurrentQueue *q, uint32_t index)
+{
+  uint64_t top = atomic_load(&q->free_top);
+  do
+  {
+    atomic_store(&q->nodes[index].free_next, index_of(top));
+  } while (!atomic_compare_exchange_weak(&q->free_top, &top, pack(index, tag_of(top) + 1)));
+}
+
+// 현재 스레드의 생산자 슬롯 번호를 돌려주는 함수 (처음 호출할 때 빈 슬롯을 배정)
+// 슬롯마다 CAS를 한 번씩만 시도하므로 배정도 정해진 단계 안에 끝난다.
+int current_producer_id(void)
+{
+  if (producer_id >= 0)
+  {
+    return producer_id;
+  }
+
+  for (int p = 0; p < MAX_PRODUCERS; p++)
+  {
+    int expected = 0;
+    if (atomic_compare_exchange_strong(&producer_in_use[p], &expected, 1))
+    {
+      producer_id = p;
+      return p;
+    }
+  }
+  fprintf(stderr, "동시에 쓰는 생산자 수가 MAX_PRODUCERS(%d)를 넘었습니다.\n", MAX_PRODUCERS);
+  abort();
+}
+
+// 생산자 스레드가 큐 사용을 마칠 때 호출하는 함수 (슬롯과 그 슬롯의 노드는 다음 생산자가 이어서 사용)
+void producer_leave(void)
+{
+  if (producer_id < 0)
+  {
+    return;
+  }
+  atomic_store(&producer_in_use[producer_id], 0);
+  producer_id = -1;
+}
+
+// MPSC 생산자 슬롯의 캐시에 노드를 돌려주는 함수 (소비자만 호출)
+void cache_push(ConcurrentQueue *q, uint32_t index)
+{
+  NodeCache *cache = &q->caches[q->nodes[index].owner];
+  uint32_t tail = atomic_load_explicit(&cache->tail, memory_order_relaxed);
+  atomic_store_explicit(&cache->slots[tail % cache->size], index, memory_order_relaxed);
+  atomic_store_explicit(&cache->tail, tail + 1, memory_order_release);
+}
+
+// 현재 생산자 슬롯의 캐시에서 노드를 꺼내는 함수 (비어 있으면 NIL)
+uint32_t cache_pop(ConcurrentQueue *q)
+{
+  NodeCache *cache = &q->caches[current_producer_id()];
+  uint32_t head = atomic_load_explicit(&cache->head, memory_order_relaxed);
+  if (head == atomic_load_explicit(&cache->tail, memory_order_acquire))
+  {
+    return NIL;
+  }
+  uint32_t index = atomic_load_explicit(&cache->slots[head % cache->size], memory_order_relaxed);
+  atomic_store_explicit(&cache->head, head + 1, memory_order_relaxed);
+  return index;
+}
+
+// 큐 초기화 함수 (capacity개의 데이터를 담을 노드와 더미 노드 하나를 미리 할당)
+void queue_init(ConcurrentQueue *q, int capacity, QueueMode mode)
+{
+  q->nodes = (Node *)malloc((capacity + 1) * sizeof(Node));
+  q->capacity = capacity;
+  q->mode = mode;
+
+  // 0번 노드는 더미, 나머지는 free list에 연결
+  // MPSC 모드에서는 노드를 생산자 슬롯에 번갈아 나눠 주고 (더미는 0번 슬롯), 처음부터 그 슬롯의 캐시에 넣어 둠
+  for (int p = 0; p < MAX_PRODUCERS; p++)
+  {
+    q->caches[p].size = 0;
+  }
+  for (int i = 0; i <= capacity; i++)
+  {
+    atomic_init(&q->nodes[i].data, 0);
+    atomic_init(&q->nodes[i].next, pack(NIL, 0));
+    atomic_init(&q->nodes[i].free_next, i < capacity ? (uint32_t)(i + 1) : NIL);
+    q->nodes[i].owner = i == 0 ? 0 : (uint32_t)(i - 1) % MAX_PRODUCERS;
+    q->caches[q->nodes[i].owner].size++;
+  }
+  for (int p = 0; p < MAX_PRODUCERS; p++)
+  {
+    NodeCache *cache = &q->caches[p];
+    cache->slots = (_Atomic uint32_t *)malloc((cache->size > 0 ? cache->size : 1) * sizeof(_Atomic uint32_t));
+    atomic_init(&cache->head, 0);
+    atomic_init(&cache->tail, 0);
+  }
+  if (mode == QUEUE_MPSC)
+  {
+    for (int i = 1; i <= capacity; i++)
+    {
+      cache_push(q, (uint32_t)i);
+    }
+  }
+  atomic_init(&q->head, pack(0, 0));
+  atomic_init(&q->tail, pack(0, 0));
+  atomic_init(&q->free_top, pack(capacity > 0 ? 1 : NIL, 0));
+}
+
+// MPMC 모드의 enqueue (Michael-Scott)
+void enqueue_mpmc(ConcurrentQueue *q, uint32_t node)
+{
+  uint64_t tail;
+  while (1)
+  {
+    tail = atomic_load(&q->tail);
+    uint64_t next = atomic_load(&q->nodes[index_of(tail)].next);
+    if (tail != atomic_load(&q->tail))
+      continue;
+
+    if (index_of(next) == NIL)
+    {
+      // 마지막 노드 뒤에 새 노드를 연결
+      if (atomic_compare_exchange_weak(&q->nodes[index_of(tail)].next, &next, pack(node, tag_of(next) + 1)))
+        break;
+    }
+    else
+    {
+      // tail이 뒤처져 있으면 한 칸 밀어 줌
+      atomic_compare_exchange_weak(&q->tail, &tail, pack(index_of(next), tag_of(tail) + 1));
+    }
+  }
+  // 실패해도 다른 스레드가 밀어 주므로 결과를 확인하지 않음
+  atomic_compare_exchange_strong(&q->tail, &tail, pack(node, tag_of(tail) + 1));
+}
+
+// MPMC 모드의 dequeue (Michael-Scott, 비어 있으면 0)
+int dequeue_mpmc(ConcurrentQueue *q, int *data)
+{
+  uint64_t head;
+  while (1)
+  {
+    head = atomic_load(&q->head);
+    uint64_t tail = atomic_load(&q->tail);
+    uint64_t next = atomic_load(&q->nodes[index_of(head)].next);
+    if (head != atomic_load(&q->head))
+      continue;
+
+    if (index_of(head) == index_of(tail))
+    {
+      if (index_of(next) == NIL)
+        return 0;
+      atomic_compare_exchange_weak(&q->tail, &tail, pack(index_of(next), tag_of(tail) + 1));
+    }
+    else
+    {
+      // CAS 전에 값을 읽어 둠 (성공하면 next가 새 더미가 되고 다른 스레드가 재사용할 수 있음)
+      int value = atomic_load_explicit(&q->nodes[index_of(next)].data, memory_order_relaxed);
+      if (atomic_compare_exchange_weak(&q->head, &head, pack(index_of(next), tag_of(head) + 1)))
+      {
+        *data = value;
+        break;
+      }
+    }
+  }
+  free_push(q, index_of(head)); // 이전 더미 노드를 재사용
+  return 1;
+}
+
+// MPSC 모드의 enqueue (Vyukov, 연결은 exchange 한 번으로 끝남)
+void enqueue_mpsc(ConcurrentQueue *q, uint32_t node)
+{
+  uint64_t prev = atomic_exchange(&q->tail, pack(node, 0));
+  // 이 사이에는 소비자가 node를 아직 볼 수 없을 뿐, 다른 생산자를 막지 않음
+  atomic_store(&q->nodes[index_of(prev)].next, pack(node, 0));
+}
+
+// MPSC 모드의 dequeue (소비자 스레드 하나만 호출, 비어 있으면 0)
+int dequeue_mpsc(ConcurrentQueue *q, int *data)
+{
+  uint32_t head = index_of(atomic_load_explicit(&q->head, memory_order_relaxed));
+  uint32_t next = index_of(atomic_load(&q->nodes[head].next));
+  if (next == NIL)
+  {
+    // 비어 있거나, 생산자가 exchange 후 아직 연결하지 않은 상태
+    return 0;
+  }
+  *data = atomic_load_explicit(&q->nodes[next].data, memory_order_relaxed);
+  atomic_store_explicit(&q->head, pack(next, 0), memory_order_relaxed);
+  cache_push(q, head); // 이전 더미 노드를 주인 생산자에게 돌려줌
+  return 1;
+}
+
+// 큐의 끝에 데이터를 넣는 함수 (노드가 모두 쓰이고 있으면 0)
+// MPSC 모드에서는 현재 생산자 슬롯의 노드가 모두 쓰이고 있으면 0
+int enqueue(ConcurrentQueue *q, int data)
+{
+  uint32_t node = q->mode == QUEUE_MPMC ? free_pop(q) : cache_pop(q);
+  if (node == NIL)
+  {
+    return 0;
+  }
+  atomic_store_explicit(&q->nodes[node].data, data, memory_order_relaxed);
+  // 재사용된 노드의 옛 링크로 CAS하던 스레드가 실패하도록 태그를 올려 둠
+  uint64_t old = atomic_load(&q->nodes[node].next);
+  atomic_store(&q->nodes[node].next, pack(NIL, tag_of(old) + 1));
+
+  if (q->mode == QUEUE_MPMC)
+  {
+    enqueue_mpmc(q, node);
+  }
+  else
+  {
+    enqueue_mpsc(q, node);
+  }
+  return 1;
+}
+
+// 큐의 앞에서 데이터를 꺼내는 함수 (비어 있으면 0)
+int dequeue(ConcurrentQueue *q, int *data)
+{
+  if (q->mode == QUEUE_MPMC)
+  {
+    return dequeue_mpmc(q, data);
+  }
+  return dequeue_mpsc(q, data);
+}
+
+// 큐의 내용을 출력하는 함수 (다른 스레드가 사용하지 않을 때 사용)
+void show(ConcurrentQueue *q)
+{
+  uint32_t current = index_of(atomic_load(&q->nodes[index_of(atomic_load(&q->head))].next));
+  if (current == NIL)
+  {
+    printf("큐가 비어 있습니다.\n");
+    return;
+  }
+  while (current != NIL)
+  {
+    printf("%d -> ", atomic_load(&q->nodes[current].data));
+    current = index_of(atomic_load(&q->nodes[current].next));
+  }
+  printf("NULL\n");
+}
+
+// 메모리 해제 함수 (모든 스레드가 끝난 뒤 호출)
+void queue_free(ConcurrentQueue *q)
+{
+  for (int p = 0; p < MAX_PRODUCERS; p++)
+  {
+    free((void *)q->caches[p].slots);
+    q->caches[p].slots = NULL;
+  }
+  free(q->nodes);
+  q->nodes = NULL;
+  q->capacity = 0;
+}
+
+// 벤치마크에서 스레드 하나가 맡는 일
+typedef struct Worker
+{
+  ConcurrentQueue *q;
+  int index;          // 생산자 번호 (소비자는 사용하지 않음)
+  int ops;            // 넣거나 꺼낼 데이터 수
+  int producers;      // 소비자가 순서를 검증할 생산자 수
+  int ok;             // 생산자별 FIFO 순서가 지켜졌으면 1
+  long long sum;      // 꺼낸 데이터의 합
+  long long *latency; // 성공한 연산별 지연 시간 (나노초, 큐가 차거나 비어 기다린 시간은 빼고 잼)
+} Worker;
+
+long long now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// 생산자: (순번 * producers + 생산자 번호)를 차례로 넣음. 큐가 차 있으면 양보 후 재시도
+void *producer(void *arg)
+{
+  Worker *w = (Worker *)arg;
+  for (int i = 0; i < w->ops; i++)
+  {
+    int value = i * w->producers + w->index;
+    while (1)
+    {
+      long long start = now_ns();
+      if (enqueue(w->q, value))
+      {
+        w->latency[i] = now_ns() - start;
+        break;
+      }
+      sched_yield();
+    }
+  }
+  producer_leave();
+  return NULL;
+}
+
+// 소비자: 꺼낸 값이 생산자마다 증가하는 순서인지 확인하며 합을 구함
+void *consumer(void *arg)
+{
+  Worker *w = (Worker *)arg;
+  int *last = (int *)malloc(w->producers * sizeof(int));
+  for (int p = 0; p < w->producers; p++)
+  {
+    last[p] = -1;
+  }
+
+  w->ok = 1;
+  for (int i = 0; i < w->ops; i++)
+  {
+    int value;
+    while (1)
+    {
+      long long start = now_ns();
+      if (dequeue(w->q, &value))
+      {
+        w->latency[i] = now_ns() - start;
+        break;
+      }
+      sched_yield();
+    }
+
+    int p = value % w->producers;
+    if (value <= last[p])
+    {
+      w->ok = 0;
+    }
+    last[p] = value;
+    w->sum += value;
+  }
+  free(last);
+  return NULL;
+}
+
+int compare_ll(const void *a, const void *b)
+{
+  long long x = *(const long long *)a;
+  long long y = *(const long long *)b;
+  return (x > y) - (x < y);
+}
+
+// 생산자 producers개, 소비자 consumers개로 per_producer개씩 주고받으며 처리량과 enqueue/dequeue p99 지연 시간을 측정
+void benchmark(QueueMode mode, int producers, int consumers, int per_producer)
+{
+  ConcurrentQueue q;
+  queue_init(&q, 1024, mode);
+
+  int threads = producers + consumers;
+  int total = producers * per_producer;
+  pthread_t *tids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+  Worker *workers = (Worker *)calloc(threads, sizeof(Worker));
+  long long *latency = (long long *)malloc(2 * (size_t)total * sizeof(long long));
+
+  long long start = now_ns();
+  for (int t = 0; t < threads; t++)
+  {
+    Worker *w = &workers[t];
+    w->q = &q;
+    w->producers = producers;
+    if (t < producers)
+    {
+      w->index = t;
+      w->ops = per_producer;
+      w->latency = latency + (size_t)t * per_producer;
+      pthread_create(&tids[t], NULL, producer, w);
+    }
+    else
+    {
+      // 꺼낼 데이터를 소비자들에게 나눔 (나머지는 앞쪽 소비자가 하나씩 더 맡음)
+      int c = t - producers;
+      w->ops = total / consumers + (c < total % consumers);
+      w->latency = latency + total + (size_t)c * (total / consumers) + (c < total % consumers ? c : total % consumers);
+      pthread_create(&tids[t], NULL, consumer, w);
+    }
+  }
+
+  int ok = 1;
+  long long sum = 0;
+  for (int t = 0; t < threads; t++)
+  {
+    pthread_join(tids[t], NULL);
+    if (t >= producers)
+    {
+      ok &= workers[t].ok;
+      sum += workers[t].sum;
+    }
+  }
+  double seconds = (now_ns() - start) / 1e9;
+
+  // 모든 데이터가 정확히 한 번씩 나왔는지 합으로 확인 (0 .. total-1)
+  ok &= sum == (long long)total * (total - 1) / 2;
+  // 앞쪽 total개는 enqueue, 뒤쪽 total개는 dequeue 지연 시간
+  qsort(latency, total, sizeof(long long), compare_ll);
+  qsort(latency + total, total, sizeof(long long), compare_ll);
+  long long enqueue_p99 = latency[(size_t)(total * 0.99)];
+  long long dequeue_p99 = latency[total + (size_t)(total * 0.99)];
+
+  printf("%s %d생산/%d소비: 초당 %.0f만 회, p99 enqueue %lldns / dequeue %lldns, 검증 %s\n",
+         mode == QUEUE_MPMC ? "MPMC" : "MPSC", producers, consumers,
+         total / seconds / 10000, enqueue_p99, dequeue_p99, ok ? "통과" : "실패");
+
+  free(latency);
+  free(workers);
+  free(tids);
+  queue_free(&q);
+}
+
+// 사용 예제
+int main()
+{
+  ConcurrentQueue q;
+  queue_init(&q, 4, QUEUE_MPMC);
+  enqueue(&q, 10);
+  enqueue(&q, 20);
+  enqueue(&q, 30);
+  show(&q);
+  int data;
+  dequeue(&q, &data);
+  printf("꺼낸 데이터: %d\n", data);
+  show(&q);
+  enqueue(&q, 40);
+  enqueue(&q, 50);
+  printf("용량 초과 enqueue: %d\n", enqueue(&q, 60));
+  show(&q);
+  while (dequeue(&q, &data))
+  {
+  }
+  show(&q);
+  queue_free(&q);
+
+  // 생산자/소비자 경쟁 상황에서 처리량과 enqueue/dequeue별 p99 지연 시간
+  int per_producer = 100000;
+  benchmark(QUEUE_MPMC, 1, 1, per_producer);
+  benchmark(QUEUE_MPMC, 2, 2, per_producer);
+  benchmark(QUEUE_MPMC, 4, 4, per_producer);
+  benchmark(QUEUE_MPSC, 1, 1, per_producer);
+  benchmark(QUEUE_MPSC, 4, 1, per_producer);
+  return 0;
+}
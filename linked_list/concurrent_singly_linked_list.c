@@ -0,0 +1,521 @@
+// 컴파일: gcc -O2 -pthread concurrent_singly_linked_list.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+/*
+ * 락 프리(lock-free) 단일 연결 리스트 (Harris-Michael)
+ *  - 정렬된 집합: insert/delete/search 모두 CAS만으로 동작
+ *  - 삭제는 두 단계: next 포인터의 최하위 비트를 표시(논리 삭제)한 뒤 앞 노드에서 떼어냄(물리 삭제)
+ *  - 떼어낸 노드는 해저드 포인터(hazard pointer)로 보호해, 다른 스레드가 읽는 중이면 해제하지 않음
+ */
+
+// 해저드 포인터를 동시에 쓸 수 있는 최대 스레드 수
+#define MAX_THREADS 128
+// 스레드당 해저드 포인터 수 (cur, next, prev 노드)
+#define HAZARDS_PER_THREAD 3
+// 스레드별 retired 목록이 이만큼 차면 해제 가능한 노드를 정리
+#define RETIRE_THRESHOLD (2 * MAX_THREADS * HAZARDS_PER_THREAD)
+
+// 락 프리 리스트의 노드를 나타내는 구조체
+typedef struct Node
+{
+  int data;                 // 노드에 저장된 데이터 (정렬 키)
+  _Atomic uintptr_t next;   // 다음 노드 주소 | 삭제 표시 비트
+} Node;
+
+// 락 프리 단일 연결 리스트를 나타내는 구조체
+typedef struct ConcurrentList
+{
+  _Atomic uintptr_t head; // 첫 노드 주소 (head 자체에는 삭제 표시가 붙지 않음)
+} ConcurrentList;
+
+// 스레드 하나의 해저드 포인터 (거짓 공유를 막기 위해 캐시 라인 단위로 정렬)
+typedef struct HazardSlot
+{
+  _Alignas(64) _Atomic(Node *) hazard[HAZARDS_PER_THREAD];
+} HazardSlot;
+
+// 스레드 하나가 해제를 미뤄 둔 노드 목록
+typedef struct RetiredList
+{
+  Node *nodes[RETIRE_THRESHOLD];
+  int count;
+} RetiredList;
+
+HazardSlot hazard_slots[MAX_THREADS];
+RetiredList retired_lists[MAX_THREADS];
+atomic_int slot_in_use[MAX_THREADS]; // 슬롯을 어떤 스레드가 쓰고 있으면 1
+atomic_int thread_count = 0;         // 한 번이라도 쓰인 슬롯 수 (해저드 검사 범위)
+_Thread_local int thread_id = -1;
+
+// 삭제 표시 비트를 다루는 함수들
+int is_marked(uintptr_t p)
+{
+  return (int)(p & 1);
+}
+
+uintptr_t marked(uintptr_t p)
+{
+  return p | 1;
+}
+
+Node *node_of(uintptr_t p)
+{
+  return (Node *)(p & ~(uintptr_t)1);
+}
+
+// 현재 스레드의 슬롯 번호를 돌려주는 함수 (처음 호출할 때 빈 슬롯을 배정)
+int current_thread_id(void)
+{
+  if (thread_id >= 0)
+  {
+    return thread_id;
+  }
+
+  for (int t = 0; t < MAX_THREADS; t++)
+  {
+    int expected = 0;
+    if (atomic_compare_exchange_strong(&slot_in_use[t], &expected, 1))
+    {
+      thread_id = t;
+      int seen = atomic_load(&thread_count);
+      while (seen <= t && !atomic_compare_exchange_weak(&thread_count, &seen, t + 1))
+      {
+      }
+      return t;
+    }
+  }
+  fprintf(stderr, "동시에 쓰는 스레드 수가 MAX_THREADS(%d)를 넘었습니다.\n", MAX_THREADS);
+  abort();
+}
+
+// 현재 스레드의 i번째 해저드 포인터에 노드를 걸어 두는 함수
+void protect(int i, Node *node)
+{
+  atomic_store(&hazard_slots[current_thread_id()].hazard[i], node);
+}
+
+// 현재 스레드의 해저드 포인터를 모두 내리는 함수
+void clear_hazards(void)
+{
+  for (int i = 0; i < HAZARDS_PER_THREAD; i++)
+  {
+    protect(i, NULL);
+  }
+}
+
+// 노드가 어떤 스레드의 해저드 포인터에 걸려 있는지 확인하는 함수
+int is_hazardous(Node *node)
+{
+  int threads = atomic_load(&thread_count);
+  for (int t = 0; t < threads && t < MAX_THREADS; t++)
+  {
+    for (int i = 0; i < HAZARDS_PER_THREAD; i++)
+    {
+      if (atomic_load(&hazard_slots[t].hazard[i]) == node)
+      {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// retired 목록에서 아무도 보고 있지 않은 노드를 해제하는 함수
+void scan_retired(RetiredList *retired)
+{
+  int kept = 0;
+  for (int i = 0; i < retired->count; i++)
+  {
+    if (is_hazardous(retired->nodes[i]))
+    {
+      retired->nodes[kept++] = retired->nodes[i];
+    }
+    else
+    {
+      free(retired->nodes[i]);
+    }
+  }
+  retired->count = kept;
+}
+
+// 리스트에서 떼어낸 노드의 해제를 미루는 함수
+void retire(Node *node)
+{
+  RetiredList *retired = &retired_lists[current_thread_id()];
+  retired->nodes[retired->count++] = node;
+  if (retired->count == RETIRE_THRESHOLD)
+  {
+    scan_retired(retired);
+  }
+}
+
+// 스레드가 리스트 사용을 마칠 때 호출하는 함수
+// 슬롯을 반납하며, 아직 해제하지 못한 retired 노드는 다음에 이 슬롯을 받는 스레드가 이어서 정리한다.
+void thread_leave(void)
+{
+  if (thread_id < 0)
+  {
+    return;
+  }
+  clear_hazards();
+  scan_retired(&retired_lists[thread_id]);
+  atomic_store(&slot_in_use[thread_id], 0);
+  thread_id = -1;
+}
+
+// 리스트 초기화 함수
+void init(ConcurrentList *list)
+{
+  atomic_init(&list->head, (uintptr_t)NULL);
+}
+
+// data가 들어갈 위치를 찾는 함수 (Michael의 find)
+// 반환 시 *prev는 cur를 가리키는 링크, cur는 data 이상인 첫 노드, next는 cur의 다음 노드
+// 지나가다 만난 삭제 표시 노드는 떼어내고 retire한다.
+// cur는 해저드 0번, next는 1번, prev 링크를 가진 노드는 2번으로 보호된 채 반환된다.
+int find(ConcurrentList *list, int data, _Atomic uintptr_t **prev_out, Node **cur_out, Node **next_out)
+{
+  _Atomic uintptr_t *prev;
+  Node *cur;
+  Node *next;
+
+try_again:
+  prev = &list->head;
+  cur = node_of(atomic_load(prev));
+  while (1)
+  {
+    if (!cur)
+    {
+      *prev_out = prev;
+      *cur_out = NULL;
+      *next_out = NULL;
+      return 0;
+    }
+
+    protect(0, cur);
+    if (atomic_load(prev) != (uintptr_t)cur)
+      goto try_again; // 보호하기 전에 cur가 바뀌었음
+
+    uintptr_t cur_next = atomic_load(&cur->next);
+    next = node_of(cur_next);
+    protect(1, next);
+    if (atomic_load(&cur->next) != cur_next)
+      goto try_again;
+
+    int cur_data = cur->data;
+    if (atomic_load(prev) != (uintptr_t)cur)
+      goto try_again;
+
+    if (!is_marked(cur_next))
+    {
+      if (cur_data >= data)
+      {
+        *prev_out = prev;
+        *cur_out = cur;
+        *next_out = next;
+        return cur_data == data;
+      }
+      prev = &cur->next;
+      protect(2, cur);
+    }
+    else
+    {
+      // cur는 논리 삭제됨: 앞 노드에서 떼어내고 해제를 미룸
+      uintptr_t expected = (uintptr_t)cur;
+      if (!atomic_compare_exchange_strong(prev, &expected, (uintptr_t)next))
+        goto try_again;
+      retire(cur);
+    }
+    cur = next;
+  }
+}
+
+// 정렬 순서를 유지하며 데이터를 삽입하는 함수 (이미 있으면 0, 삽입하면 1)
+int insert(ConcurrentList *list, int data)
+{
+  _Atomic uintptr_t *prev;
+  Node *cur;
+  Node *next;
+  Node *new_node = (Node *)malloc(sizeof(Node));
+  new_node->data = data;
+
+  while (1)
+  {
+    if (find(list, data, &prev, &cur, &next))
+    {
+      free(new_node);
+      clear_hazards();
+      return 0;
+    }
+    atomic_store(&new_node->next, (uintptr_t)cur);
+    uintptr_t expected = (uintptr_t)cur;
+    if (atomic_compare_exchange_strong(prev, &expected, (uintptr_t)new_node))
+    {
+      clear_hazards();
+      return 1;
+    }
+  }
+}
+
+// 지정된 데이터를 가진 노드를 삭제하는 함수 (없으면 0, 삭제하면 1)
+int delete(ConcurrentList *list, int data)
+{
+  _Atomic uintptr_t *prev;
+  Node *cur;
+  Node *next;
+
+  while (1)
+  {
+    if (!find(list, data, &prev, &cur, &next))
+    {
+      clear_hazards();
+      return 0;
+    }
+
+    // 1단계: cur->next에 삭제 표시 (다른 스레드가 cur 뒤에 삽입하지 못하게 함)
+    uintptr_t expected = (uintptr_t)next;
+    if (!atomic_compare_exchange_strong(&cur->next, &expected, marked((uintptr_t)next)))
+      continue;
+
+    // 2단계: 앞 노드에서 떼어냄. 실패하면 find가 대신 떼어내도록 한 번 더 순회
+    expected = (uintptr_t)cur;
+    if (atomic_compare_exchange_strong(prev, &expected, (uintptr_t)next))
+    {
+      retire(cur);
+    }
+    else
+    {
+      find(list, data, &prev, &cur, &next);
+    }
+    clear_hazards();
+    return 1;
+  }
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수
+int search(ConcurrentList *list, int data)
+{
+  _Atomic uintptr_t *prev;
+  Node *cur;
+  Node *next;
+  int found = find(list, data, &prev, &cur, &next);
+  clear_hazards();
+  return found;
+}
+
+// 리스트의 노드 수를 세는 함수 (다른 스레드가 수정하지 않을 때만 정확함)
+int length(ConcurrentList *list)
+{
+  int count = 0;
+  for (Node *current = node_of(atomic_load(&list->head)); current; current = node_of(atomic_load(&current->next)))
+  {
+    if (!is_marked(atomic_load(&current->next)))
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+// 리스트의 내용을 출력하는 함수 (다른 스레드가 수정하지 않을 때 사용)
+void show(ConcurrentList *list)
+{
+  Node *current = node_of(atomic_load(&list->head));
+  if (!current)
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+  while (current)
+  {
+    uintptr_t next = atomic_load(&current->next);
+    if (!is_marked(next))
+    {
+      printf("%d -> ", current->data);
+    }
+    current = node_of(next);
+  }
+  printf("NULL\n");
+}
+
+// 메모리 해제 함수 (이 리스트를 쓰는 스레드가 모두 끝난 뒤 호출)
+// 리스트에 남은 노드만 바로 해제한다. retired 목록에는 다른 리스트에서 떼어낸 노드도 섞여 있으므로,
+// 해저드 포인터를 확인하는 scan_retired로만 정리한다.
+void free_list(ConcurrentList *list)
+{
+  Node *current = node_of(atomic_load(&list->head));
+  Node *next;
+  while (current)
+  {
+    next = node_of(atomic_load(&current->next));
+    free(current);
+    current = next;
+  }
+  atomic_store(&list->head, (uintptr_t)NULL);
+
+  // 자기 슬롯과 지금 아무도 쓰지 않는 슬롯을 정리 (쓰는 중인 슬롯은 그 스레드가 정리)
+  int threads = atomic_load(&thread_count);
+  for (int t = 0; t < threads && t < MAX_THREADS; t++)
+  {
+    int expected = 0;
+    if (t == thread_id)
+    {
+      scan_retired(&retired_lists[t]);
+    }
+    else if (atomic_compare_exchange_strong(&slot_in_use[t], &expected, 1))
+    {
+      scan_retired(&retired_lists[t]);
+      atomic_store(&slot_in_use[t], 0);
+    }
+  }
+}
+
+// 스트레스 테스트에서 스레드 하나가 맡는 일
+typedef struct Worker
+{
+  ConcurrentList *list;
+  int index;   // 스레드 순번
+  int ops;     // 수행할 연산 수
+  int key_range;
+  long checksum;
+} Worker;
+
+// 각 스레드가 자기 몫의 키(index, index + threads, ...)를 넣고, 짝수 번째 키를 다시 지움
+// 동시에 전체 키 범위에 대해 search와 공용 키에 대한 insert/delete를 섞어 경쟁을 만듦
+void *stress_worker(void *arg)
+{
+  Worker *w = (Worker *)arg;
+  unsigned state = 2463534242u + w->index * 7919u;
+  for (int i = 0; i < w->ops; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    int key = (int)(state % (unsigned)w->key_range);
+    switch (state >> 30)
+    {
+    case 0:
+      insert(w->list, -1 - key); // 모든 스레드가 다투는 음수 영역
+      break;
+    case 1:
+      delete (w->list, -1 - key);
+      break;
+    default:
+      w->checksum += search(w->list, key);
+      break;
+    }
+  }
+  thread_leave();
+  return NULL;
+}
+
+typedef struct OwnedWorker
+{
+  ConcurrentList *list;
+  int index;
+  int threads;
+  int per_thread;
+} OwnedWorker;
+
+// 스레드마다 겹치지 않는 키를 넣고 절반을 지우는 작업 (결과를 정확히 검증할 수 있음)
+void *owned_worker(void *arg)
+{
+  OwnedWorker *w = (OwnedWorker *)arg;
+  for (int i = 0; i < w->per_thread; i++)
+  {
+    insert(w->list, i * w->threads + w->index);
+  }
+  for (int i = 0; i < w->per_thread; i += 2)
+  {
+    delete (w->list, i * w->threads + w->index);
+  }
+  thread_leave();
+  return NULL;
+}
+
+double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 사용 예제
+int main()
+{
+  ConcurrentList list;
+  init(&list);
+  insert(&list, 30);
+  insert(&list, 10);
+  insert(&list, 20);
+  show(&list);
+  insert(&list, 5);
+  show(&list);
+  delete (&list, 20);
+  show(&list);
+  printf("10 검색: %d\n", search(&list, 10));
+  printf("40 검색: %d\n", search(&list, 40));
+  printf("리스트 길이: %d\n", length(&list));
+  free_list(&list);
+
+  // 스트레스 테스트: 겹치지 않는 키를 동시에 넣고 지운 뒤 결과 검증
+  int threads = 16;
+  int per_thread = 500;
+  pthread_t tids[MAX_THREADS];
+  OwnedWorker owned[MAX_THREADS];
+  init(&list);
+  for (int t = 0; t < threads; t++)
+  {
+    owned[t] = (OwnedWorker){&list, t, threads, per_thread};
+    pthread_create(&tids[t], NULL, owned_worker, &owned[t]);
+  }
+  for (int t = 0; t < threads; t++)
+  {
+    pthread_join(tids[t], NULL);
+  }
+  // 남아 있어야 하는 키: 홀수 i에 대해 i * threads + t (t = 0..threads-1), 오름차순
+  int ok = length(&list) == threads * per_thread / 2;
+  Node *n = node_of(atomic_load(&list.head));
+  for (int i = 1; i < per_thread && ok; i += 2)
+  {
+    for (int t = 0; t < threads && ok; t++)
+    {
+      ok = n && n->data == i * threads + t;
+      n = n ? node_of(atomic_load(&n->next)) : NULL;
+    }
+  }
+  printf("스트레스 테스트 (%d스레드): %s\n", threads, ok ? "통과" : "실패");
+  free_list(&list);
+
+  // 확장성: 스레드 수를 1에서 64까지 늘려 가며 초당 연산 수 측정
+  int total_ops = 400000;
+  for (int n = 1; n <= 64; n *= 2)
+  {
+    Worker workers[MAX_THREADS];
+    init(&list);
+    for (int k = 0; k < 128; k++)
+    {
+      insert(&list, k);
+    }
+    double start = now_seconds();
+    for (int t = 0; t < n; t++)
+    {
+      workers[t] = (Worker){&list, t, total_ops / n, 256, 0};
+      pthread_create(&tids[t], NULL, stress_worker, &workers[t]);
+    }
+    for (int t = 0; t < n; t++)
+    {
+      pthread_join(tids[t], NULL);
+    }
+    double seconds = now_seconds() - start;
+    printf("%2d스레드: 초당 %.0f만 회\n", n, total_ops / seconds / 10000);
+    free_list(&list);
+  }
+  return 0;
+}
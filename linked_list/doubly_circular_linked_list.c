@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 
 /*
  * 이중 원형 연결 리스트 노드 구조체
@@ -14,15 +16,257 @@ typedef struct Node
   struct Node *prev;
 } Node;
 
+/* 슬랩 하나에 담기는 노드 수 */
+#define SLAB_NODES 256
+
+/*
+ * 노드 풀의 슬랩 구조체
+ *  - 여러 노드를 한 번의 malloc으로 할당한 블록
+ *  - next: 다음 슬랩
+ *  - nodes: 노드 배열
+ */
+typedef struct Slab
+{
+  struct Slab *next;
+  Node nodes[];
+} Slab;
+
+/*
+ * 슬랩 그룹 구조체 (노드를 주고받은 리스트들이 함께 소유하는 슬랩 목록)
+ *  - list_split_at으로 나뉜 두 리스트는 같은 슬랩의 노드를 나눠 가지므로, 슬랩을 그룹 단위로 참조 수를 세어
+ *    그룹을 쓰는 마지막 리스트가 해제될 때 한 번에 해제
+ *  - list_concat/list_splice는 두 그룹을 O(1)에 합침
+ *  - parent: 다른 그룹에 합쳐졌으면 그 그룹 (대표 그룹이면 NULL)
+ *  - merged, next_merged: 이 그룹에 합쳐진 그룹 목록 (대표 그룹과 함께 해제)
+ *  - slabs, last_slab: 할당된 슬랩 목록과 마지막 슬랩 (대표 그룹만 가짐)
+ *  - refs: 이 그룹을 쓰는 풀 수 (대표 그룹에서만 셈)
+ */
+typedef struct SlabGroup
+{
+  struct SlabGroup *parent;
+  struct SlabGroup *merged;
+  struct SlabGroup *next_merged;
+  Slab *slabs;
+  Slab *last_slab;
+  int refs;
+} SlabGroup;
+
+/*
+ * 노드 풀 구조체
+ *  - group: 슬랩을 등록하는 그룹 (처음 슬랩을 할당할 때 만듦)
+ *  - free_nodes: 반환된 노드를 재사용하기 위한 free list (next로 연결)
+ *  - free_tail: free list의 마지막 노드 (free list를 O(1)에 넘기기 위해 유지)
+ */
+typedef struct NodePool
+{
+  SlabGroup *group;
+  Node *free_nodes;
+  Node *free_tail;
+} NodePool;
+
 /*
  * 이중 원형 연결 리스트를 나타내는 구조체
  *  - head: 리스트의 시작 노드를 가리키는 포인터
+ *  - size: 노드 수 (length를 O(1)로 만들기 위해 유지)
+ *  - pool: 노드를 할당하는 리스트 전용 노드 풀
+ *  - cursor, cursor_index: 마지막으로 get_nth로 접근한 노드와 그 위치 (cursor가 NULL이면 없음)
+ *  - tail은 항상 head->prev 이므로 따로 저장하지 않음
  */
 typedef struct DoublyLinkedList
 {
   Node *head;
+  int size;
+  NodePool pool;
+  Node *cursor;
+  int cursor_index;
 } DoublyLinkedList;
 
+/*
+ * 리스트 순회용 반복자 구조체
+ *  - node: 현재 노드
+ *  - index: 현재 위치
+ *  - size: 순회할 노드 수 (index가 size에 닿으면 한 바퀴 완료)
+ */
+typedef struct ListIter
+{
+  Node *node;
+  int index;
+  int size;
+} ListIter;
+
+/*
+ * 노드 풀 초기화 함수 (pool_init)
+ */
+void pool_init(NodePool *pool)
+{
+  pool->group = NULL;
+  pool->free_nodes = NULL;
+  pool->free_tail = NULL;
+}
+
+/*
+ * 풀이 속한 대표 그룹을 반환하는 함수 (pool_group)
+ *  - 그룹이 없으면 새로 만듦
+ *  - 합쳐진 그룹은 parent를 따라 올라가고, 다음 호출이 바로 찾도록 pool->group을 대표 그룹으로 바꿔 둠
+ */
+SlabGroup *pool_group(NodePool *pool)
+{
+  if (!pool->group)
+  {
+    pool->group = (SlabGroup *)calloc(1, sizeof(SlabGroup));
+    pool->group->refs = 1;
+  }
+  while (pool->group->parent)
+    pool->group = pool->group->parent;
+  return pool->group;
+}
+
+/*
+ * 새 슬랩을 풀의 그룹에 등록하는 함수 (pool_add_slab)
+ */
+void pool_add_slab(NodePool *pool, Slab *slab)
+{
+  SlabGroup *group = pool_group(pool);
+  slab->next = group->slabs;
+  group->slabs = slab;
+  if (!group->last_slab)
+    group->last_slab = slab;
+}
+
+/*
+ * 풀에서 노드 하나를 꺼내는 함수 (pool_alloc)
+ *  - free list가 비어 있으면 새 슬랩을 할당해 노드들을 free list에 연결
+ *  - free list의 첫 노드를 꺼내 반환
+ */
+Node *pool_alloc(NodePool *pool)
+{
+  if (!pool->free_nodes)
+  {
+    Slab *slab = (Slab *)malloc(sizeof(Slab) + SLAB_NODES * sizeof(Node));
+    pool_add_slab(pool, slab);
+    for (int i = 0; i < SLAB_NODES - 1; i++)
+    {
+      slab->nodes[i].next = &slab->nodes[i + 1];
+    }
+    slab->nodes[SLAB_NODES - 1].next = NULL;
+    pool->free_nodes = &slab->nodes[0];
+    pool->free_tail = &slab->nodes[SLAB_NODES - 1];
+  }
+
+  Node *node = pool->free_nodes;
+  pool->free_nodes = node->next;
+  return node;
+}
+
+/*
+ * 노드를 풀에 반환하는 함수 (pool_free)
+ *  - free를 호출하지 않고 free list 맨 앞에 넣어 재사용
+ */
+void pool_free(NodePool *pool, Node *node)
+{
+  if (!pool->free_nodes)
+    pool->free_tail = node;
+  node->next = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+/*
+ * 노드 n개를 한 블록으로 할당하는 함수 (pool_alloc_block)
+ *  - 크기가 n인 슬랩 하나를 할당해 노드 배열을 그대로 반환 (free list를 거치지 않음)
+ *  - 다른 슬랩과 함께 pool_destroy가 한 번에 해제
+ */
+Node *pool_alloc_block(NodePool *pool, size_t n)
+{
+  Slab *slab = (Slab *)malloc(sizeof(Slab) + n * sizeof(Node));
+  pool_add_slab(pool, slab);
+  return slab->nodes;
+}
+
+/*
+ * 대표 그룹과 그 그룹에 합쳐진 그룹들을 슬랩과 함께 해제하는 함수 (group_free)
+ *  - 합쳐진 그룹 목록을 pending에 펼쳐 가며 해제 (재귀 없음)
+ */
+void group_free(SlabGroup *group)
+{
+  group->next_merged = NULL;
+  SlabGroup *pending = group;
+  while (pending)
+  {
+    SlabGroup *current = pending;
+    pending = current->next_merged;
+    for (SlabGroup *child = current->merged, *next; child; child = next)
+    {
+      next = child->next_merged;
+      child->next_merged = pending;
+      pending = child;
+    }
+
+    Slab *slab = current->slabs;
+    Slab *next;
+    while (slab)
+    {
+      next = slab->next;
+      free(slab);
+      slab = next;
+    }
+    free(current);
+  }
+}
+
+/*
+ * 풀을 해제하는 함수 (pool_destroy)
+ *  - 그룹을 쓰는 마지막 풀이면 그룹의 모든 슬랩을 해제
+ *  - 노드 수가 아니라 슬랩 수만큼만 반복
+ */
+void pool_destroy(NodePool *pool)
+{
+  if (pool->group)
+  {
+    SlabGroup *group = pool_group(pool);
+    if (--group->refs == 0)
+      group_free(group);
+  }
+  pool_init(pool);
+}
+
+/*
+ * 대표 그룹 from을 대표 그룹 into에 합치는 함수 (group_union, O(1))
+ *  - from의 슬랩 목록을 into 앞에 잇고 참조 수를 더함
+ *  - from은 into의 merged 목록에 들어가 into와 함께 해제됨
+ */
+void group_union(SlabGroup *into, SlabGroup *from)
+{
+  if (into == from)
+    return;
+
+  from->parent = into;
+  into->refs += from->refs;
+  if (from->slabs)
+  {
+    from->last_slab->next = into->slabs;
+    into->slabs = from->slabs;
+    if (!into->last_slab)
+      into->last_slab = from->last_slab;
+  }
+  from->slabs = NULL;
+  from->last_slab = NULL;
+  from->next_merged = into->merged;
+  into->merged = from;
+}
+
+/*
+ * dst 풀이 src 풀의 슬랩 그룹을 함께 쓰게 하는 함수 (pool_share)
+ *  - list_split_at이 노드를 나눠 줄 때 사용, 참조 수만 늘림
+ */
+void pool_share(NodePool *dst, NodePool *src)
+{
+  if (src->group)
+  {
+    dst->group = pool_group(src);
+    dst->group->refs++;
+  }
+}
+
 /*
  * 리스트 초기화 함수
  *  - head 포인터를 NULL로 설정해 리스트가 비었다고 표시
@@ -30,6 +274,10 @@ typedef struct DoublyLinkedList
 void init(DoublyLinkedList *list)
 {
   list->head = NULL;
+  list->size = 0;
+  pool_init(&list->pool);
+  list->cursor = NULL;
+  list->cursor_index = 0;
 }
 
 /*
@@ -43,13 +291,14 @@ int is_empty(DoublyLinkedList *list)
 
 /*
  * 리스트의 끝에 새 노드를 추가하는 함수 (append)
- *  1. 새 노드 동적 할당 및 data 저장
+ *  1. 노드 풀에서 새 노드를 할당하고 data 저장
  *  2. 리스트가 비어 있으면, 새 노드를 자기 자신으로 next와 prev 연결 후 head로 지정
  *  3. 비어 있지 않으면, head->prev(현재 마지막 노드) 뒤에 새 노드 삽입
+ *  4. 추가된 노드를 핸들로 반환 (remove_node/insert_after/insert_before에 사용)
  */
-void append(DoublyLinkedList *list, int data)
+Node *append(DoublyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = NULL;
   new_node->prev = NULL;
@@ -74,17 +323,74 @@ void append(DoublyLinkedList *list, int data)
     // head의 prev를 새 노드로 갱신 (마지막 노드를 새 노드로 변경)
     list->head->prev = new_node;
   }
+  list->size++;
+  return new_node;
+}
+
+/*
+ * 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수 (list_append_array)
+ *  1. 노드 n개를 연속된 블록 하나로 할당 (append를 n번 호출하는 대신 할당 한 번)
+ *  2. 블록 안에서 순회 순서대로 next/prev 연결 (이후 순회가 메모리를 순서대로 읽음)
+ *  3. 기존 tail(head->prev)과 head 사이에 블록 전체를 끼워 원형 유지
+ */
+void list_append_array(DoublyLinkedList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+    return;
+
+  Node *nodes = pool_alloc_block(&list->pool, n);
+  for (size_t i = 0; i < n; i++)
+  {
+    nodes[i].data = vals[i];
+    if (i + 1 < n)
+    {
+      nodes[i].next = &nodes[i + 1];
+      nodes[i + 1].prev = &nodes[i];
+    }
+  }
+
+  Node *first = &nodes[0];
+  Node *last = &nodes[n - 1];
+  if (is_empty(list))
+  {
+    // 빈 리스트였다면 블록의 양 끝을 서로 연결해 원형으로 만듦
+    list->head = first;
+    last->next = first;
+    first->prev = last;
+  }
+  else
+  {
+    Node *tail = list->head->prev;
+    tail->next = first;
+    first->prev = tail;
+    last->next = list->head;
+    list->head->prev = last;
+  }
+  list->size += (int)n;
+}
+
+/*
+ * 배열로 새 리스트를 만드는 함수 (list_from_array)
+ *  - 초기화 후 list_append_array로 한 번에 채워 반환
+ */
+DoublyLinkedList list_from_array(const int *vals, size_t n)
+{
+  DoublyLinkedList list;
+  init(&list);
+  list_append_array(&list, vals, n);
+  return list;
 }
 
 /*
  * 리스트의 시작에 새 노드를 추가하는 함수 (prepend)
- *  1. 새 노드 동적 할당 및 data 저장
+ *  1. 노드 풀에서 새 노드를 할당하고 data 저장
  *  2. 리스트가 비어 있으면, 자기 자신을 가리키도록 next/prev 설정 후 head로 지정
  *  3. 비어 있지 않으면, head 앞에 새 노드를 삽입하고, head를 새 노드로 변경
+ *  4. 추가된 노드를 핸들로 반환
  */
-void prepend(DoublyLinkedList *list, int data)
+Node *prepend(DoublyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = NULL;
   new_node->prev = NULL;
@@ -111,15 +417,76 @@ void prepend(DoublyLinkedList *list, int data)
     // head를 새 노드로 갱신
     list->head = new_node;
   }
+  list->size++;
+  if (list->cursor)
+  {
+    list->cursor_index++; // 모든 노드의 위치가 한 칸씩 밀림
+  }
+  return new_node;
+}
+
+/*
+ * 노드 핸들 바로 뒤에 새 노드를 삽입하는 함수 (insert_after)
+ *  - 원형 구조이므로 node->next가 항상 존재해 검색 없이 O(1)로 연결
+ *  - node가 tail이면 새 노드가 새 tail이 됨 (head는 그대로)
+ */
+Node *insert_after(DoublyLinkedList *list, Node *node, int data)
+{
+  Node *new_node = pool_alloc(&list->pool);
+  new_node->data = data;
+  new_node->prev = node;
+  new_node->next = node->next;
+  node->next->prev = new_node;
+  node->next = new_node;
+  list->size++;
+  list->cursor = NULL; // 위치가 바뀔 수 있으므로 cursor를 버림
+  return new_node;
+}
+
+/*
+ * 노드 핸들 바로 앞에 새 노드를 삽입하는 함수 (insert_before)
+ *  - node가 head이면 새 노드가 새 head가 됨
+ */
+Node *insert_before(DoublyLinkedList *list, Node *node, int data)
+{
+  Node *new_node = insert_after(list, node->prev, data);
+  if (node == list->head)
+  {
+    list->head = new_node;
+  }
+  return new_node;
+}
+
+/*
+ * 노드 핸들이 가리키는 노드를 삭제하는 함수 (remove_node)
+ *  - 검색 없이 앞뒤 노드를 서로 연결해 O(1)로 제거
+ *  - 유일한 노드였다면 head = NULL, 삭제 대상이 head였다면 head를 다음 노드로
+ */
+void remove_node(DoublyLinkedList *list, Node *node)
+{
+  if (node->next == node)
+  {
+    list->head = NULL;
+  }
+  else
+  {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    if (node == list->head)
+    {
+      list->head = node->next;
+    }
+  }
+  pool_free(&list->pool, node);
+  list->size--;
+  list->cursor = NULL; // 위치가 바뀔 수 있으므로 cursor를 버림
 }
 
 /*
  * 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수 (delete)
  *  1. 리스트가 비어있으면 에러 메시지 출력
  *  2. 비어있지 않으면, head부터 시작하여 한 바퀴를 순회하며 data를 가진 노드를 찾음
- *  3. 찾으면, 해당 노드를 원형 연결에서 제거
- *     - 만약 삭제 대상이 head이고, 그것이 유일한 노드였다면 head = NULL
- *     - 그 외에는 포인터(prev, next) 연결을 재조정
+ *  3. 찾으면, remove_node로 해당 노드를 원형 연결에서 제거
  */
 void delete(DoublyLinkedList *list, int data)
 {
@@ -136,26 +503,7 @@ void delete(DoublyLinkedList *list, int data)
   {
     if (current->data == data)
     {
-      // 노드를 찾았을 때
-      // 노드가 딱 하나인 경우 (current->next == current)
-      if (current->next == current && current->prev == current)
-      {
-        list->head = NULL;
-      }
-      else
-      {
-        // 여러 노드가 있는 경우
-        Node *prev_node = current->prev;
-        Node *next_node = current->next;
-        prev_node->next = next_node;
-        next_node->prev = prev_node;
-        // 만약 삭제하는 노드가 head라면 head를 다음 노드로 변경
-        if (current == list->head)
-        {
-          list->head = next_node;
-        }
-      }
-      free(current);
+      remove_node(list, current);
       return;
     }
     current = current->next;
@@ -252,30 +600,19 @@ void reverse(DoublyLinkedList *list)
   {
     list->head = temp->prev;
   }
+  if (list->cursor)
+  {
+    list->cursor_index = list->size - 1 - list->cursor_index; // cursor 노드의 위치가 뒤집힘
+  }
 }
 
 /*
- * 리스트의 노드 수를 계산하는 함수 (length)
- *  - 한 바퀴 순회하며 노드의 개수를 센다
+ * 리스트의 노드 수를 반환하는 함수 (length)
+ *  - append/prepend/delete에서 유지하는 size를 그대로 반환 (O(1))
  */
 int length(DoublyLinkedList *list)
 {
-  if (is_empty(list))
-    return 0;
-
-  int count = 0;
-  Node *current = list->head;
-  Node *start = list->head;
-
-  while (1)
-  {
-    count++;
-    current = current->next;
-    if (current == start)
-      break;
-  }
-
-  return count;
+  return list->size;
 }
 
 /*
@@ -303,61 +640,704 @@ int find_middle(DoublyLinkedList *list)
 
 /*
  * 리스트에서 N번째 노드 데이터를 찾는 함수 (get_nth)
- *  - head부터 시작하여 n번 인덱스를 만날 때까지 이동
- *  - 만약 리스트 길이를 초과하면 에러 메시지 출력
+ *  - head(0번), tail(head->prev, size-1번), 마지막으로 접근한 cursor 중
+ *    n에 가장 가까운 곳에서 출발해 next 또는 prev 방향으로 이동
+ *  - 접근한 노드를 cursor로 기억하므로 i = 0..n-1 순서로 호출해도 전체 O(n)
+ *  - 범위를 벗어나면 에러 메시지 출력
  */
 int get_nth(DoublyLinkedList *list, int n)
 {
-  if (is_empty(list))
+  if (n < 0 || n >= list->size)
   {
     printf("인덱스가 범위를 벗어났습니다.\n");
     return -1;
   }
 
   Node *current = list->head;
-  Node *start = list->head;
   int count = 0;
-
-  while (1)
+  int distance = n;
+  if (list->size - 1 - n < distance)
+  {
+    // tail에서 뒤로 가는 편이 가까움
+    current = list->head->prev;
+    count = list->size - 1;
+    distance = list->size - 1 - n;
+  }
+  if (list->cursor && abs(n - list->cursor_index) < distance)
+  {
+    current = list->cursor;
+    count = list->cursor_index;
+  }
+  while (count < n)
   {
-    if (count == n)
-    {
-      return current->data;
-    }
-    count++;
     current = current->next;
-    if (current == start)
-      break;
+    count++;
+  }
+  while (count > n)
+  {
+    current = current->prev;
+    count--;
   }
 
-  printf("인덱스가 범위를 벗어났습니다.\n");
-  return -1;
+  list->cursor = current;
+  list->cursor_index = n;
+  return current->data;
 }
 
 /*
  * 메모리 해제 함수 (free_list)
- *  - 리스트 내 모든 노드를 한 바퀴 순회하며 free
+ *  - 노드를 하나씩 free하지 않고 풀의 슬랩을 통째로 해제 (슬랩 수만큼만 반복)
  *  - head를 NULL로 설정해 리스트 비움
  */
 void free_list(DoublyLinkedList *list)
 {
-  if (is_empty(list))
-    return;
+  pool_destroy(&list->pool);
+  list->head = NULL;
+  list->size = 0;
+  list->cursor = NULL;
+  list->cursor_index = 0;
+}
+
+/*
+ * 반복자를 head에 두는 함수 (list_iter_begin)
+ */
+ListIter list_iter_begin(DoublyLinkedList *list)
+{
+  ListIter it = {list->head, 0, list->size};
+  return it;
+}
+
+/*
+ * 반복자가 한 바퀴를 다 돌았는지 확인하는 함수 (list_iter_end)
+ */
+int list_iter_end(ListIter *it)
+{
+  return it->index >= it->size;
+}
+
+/*
+ * 반복자를 다음 노드로 옮기는 함수 (list_iter_next)
+ */
+void list_iter_next(ListIter *it)
+{
+  it->node = it->node->next;
+  it->index++;
+}
 
+/*
+ * 리스트의 데이터를 배열로 복사하는 함수 (list_to_array_bounded)
+ *  - head부터 최대 max개까지 out에 복사 (부분 스냅샷)
+ *  - 원형이므로 size만큼만 복사하고 멈춤
+ *  - 실제로 복사한 개수를 반환
+ */
+int list_to_array_bounded(DoublyLinkedList *list, int *out, int max)
+{
+  int count = list->size < max ? list->size : max;
   Node *current = list->head;
-  Node *start = list->head;
-  Node *next_node = NULL;
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = current->data;
+    current = current->next;
+  }
+  return count;
+}
 
-  while (1)
+/*
+ * 리스트의 모든 데이터를 배열로 복사하는 함수 (list_to_array)
+ *  - out은 length(list)개 이상의 공간을 가져야 함
+ */
+int list_to_array(DoublyLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+/* 직렬화 형식을 확인하는 값과 형식 버전 */
+#define LIST_MAGIC "DSAL"
+#define LIST_FORMAT_VERSION 1
+/* list_read가 한 번에 모아 list_append_array로 붙이는 데이터 수 */
+#define LIST_READ_CHUNK 4096
+
+/*
+ * 부호 있는 차이를 작은 양수로 바꾸는 함수 (zigzag_encode / zigzag_decode)
+ *  - 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+ */
+uint64_t zigzag_encode(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t zigzag_decode(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+/*
+ * 가변 길이 정수(varint)를 쓰는 함수 (write_varint)
+ *  - 7비트씩 나눠 기록하고, 뒤에 바이트가 더 있으면 최상위 비트를 1로 표시
+ */
+void write_varint(FILE *fp, uint64_t v)
+{
+  while (v >= 0x80)
   {
-    next_node = current->next;
-    free(current);
-    current = next_node;
-    if (current == start)
-      break;
+    putc((int)(v & 0x7F) | 0x80, fp);
+    v >>= 7;
   }
+  putc((int)v, fp);
+}
 
-  list->head = NULL;
+/*
+ * varint를 읽는 함수 (read_varint)
+ *  - 성공하면 0, 파일이 끝났거나 형식이 틀리면 -1
+ */
+int read_varint(FILE *fp, uint64_t *out)
+{
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    int c = getc(fp);
+    if (c == EOF)
+      return -1;
+    v |= (uint64_t)(c & 0x7F) << shift;
+    if (!(c & 0x80))
+    {
+      *out = v;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+/*
+ * 리스트를 이진 형식으로 기록하는 함수 (list_write)
+ *  - 형식: "DSAL" | 버전(1바이트) | 노드 수(varint) | 앞 데이터와의 차이(zigzag varint) x 노드 수
+ *  - head부터 size개를 하나씩 스트림에 쓰므로 리스트 크기와 관계없이 추가 메모리를 쓰지 않음
+ *  - 성공하면 0
+ */
+int list_write(DoublyLinkedList *list, FILE *fp)
+{
+  fwrite(LIST_MAGIC, 1, 4, fp);
+  putc(LIST_FORMAT_VERSION, fp);
+  write_varint(fp, (uint64_t)list->size);
+
+  int64_t prev = 0;
+  Node *current = list->head;
+  for (int i = 0; i < list->size; i++)
+  {
+    write_varint(fp, zigzag_encode((int64_t)current->data - prev));
+    prev = current->data;
+    current = current->next;
+  }
+  return ferror(fp) ? -1 : 0;
+}
+
+/*
+ * list_write로 기록한 리스트를 읽어 끝에 추가하는 함수 (list_read)
+ *  - LIST_READ_CHUNK개씩 모아 list_append_array로 붙이므로 파일 전체를 메모리에 올리지 않음
+ *  - 성공하면 0, 형식이 틀리거나 중간에 끝나면 -1 (중간에 끝나면 읽은 데까지는 추가됨)
+ */
+int list_read(DoublyLinkedList *list, FILE *fp)
+{
+  char magic[4];
+  uint64_t count;
+  if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LIST_MAGIC, 4) != 0 ||
+      getc(fp) != LIST_FORMAT_VERSION || read_varint(fp, &count) != 0)
+  {
+    printf("리스트 파일 형식이 맞지 않습니다.\n");
+    return -1;
+  }
+
+  int buffer[LIST_READ_CHUNK];
+  int filled = 0;
+  int64_t prev = 0;
+  for (uint64_t i = 0; i < count; i++)
+  {
+    uint64_t v;
+    if (read_varint(fp, &v) != 0)
+    {
+      list_append_array(list, buffer, filled);
+      printf("리스트 파일이 중간에 끝났습니다.\n");
+      return -1;
+    }
+    prev += zigzag_decode(v);
+    buffer[filled++] = (int)prev;
+    if (filled == LIST_READ_CHUNK)
+    {
+      list_append_array(list, buffer, filled);
+      filled = 0;
+    }
+  }
+  list_append_array(list, buffer, filled);
+  return 0;
+}
+
+/*
+ * 노드들이 메모리에 얼마나 흩어져 있는지 구하는 함수 (fragmentation)
+ *  - head부터 순회하며 다음 노드가 메모리상 바로 옆 칸이 아닌 경우의 비율 (0.0 ~ 1.0)
+ *  - 마지막 노드에서 head로 돌아가는 링크는 세지 않음
+ *  - list_compact 직후에는 0
+ */
+double fragmentation(DoublyLinkedList *list)
+{
+  if (list->size < 2)
+    return 0.0;
+
+  int scattered = 0;
+  Node *current = list->head;
+  for (int i = 0; i < list->size - 1; i++)
+  {
+    if (current->next != current + 1)
+    {
+      scattered++;
+    }
+    current = current->next;
+  }
+  return (double)scattered / (list->size - 1);
+}
+
+/*
+ * 모든 노드를 새 연속 블록 하나에 다시 배치하는 함수 (list_compact, 조각 모음)
+ *  1. 새 풀에서 size개짜리 블록을 할당해 head부터 순회 순서대로 데이터 복사
+ *  2. 블록 안에서 next/prev를 다시 연결하고, 양 끝을 이어 원형 유지
+ *  3. 이전 슬랩을 모두 해제하고 새 풀로 교체 (cursor는 같은 위치의 새 노드로 옮김)
+ *  - 이전 노드 핸들(append/insert_after 등의 반환값)은 더 이상 쓸 수 없음
+ */
+void list_compact(DoublyLinkedList *list)
+{
+  NodePool fresh;
+  pool_init(&fresh);
+  if (list->size > 0)
+  {
+    int n = list->size;
+    Node *nodes = pool_alloc_block(&fresh, n);
+    Node *current = list->head;
+    for (int i = 0; i < n; i++)
+    {
+      nodes[i].data = current->data;
+      nodes[i].next = &nodes[(i + 1) % n];
+      nodes[i].prev = &nodes[(i + n - 1) % n];
+      current = current->next;
+    }
+    list->head = &nodes[0];
+    if (list->cursor)
+    {
+      list->cursor = &nodes[list->cursor_index];
+    }
+  }
+  pool_destroy(&list->pool);
+  list->pool = fresh;
+}
+
+/*
+ * 조각화 정도가 threshold 이상일 때만 조각 모음을 하는 함수 (list_compact_if_fragmented)
+ *  - 수행했으면 1, 아니면 0
+ *  - 조각화 측정이 O(n)이므로 연산마다가 아니라 주기적으로 호출
+ */
+int list_compact_if_fragmented(DoublyLinkedList *list, double threshold)
+{
+  if (fragmentation(list) < threshold)
+    return 0;
+
+  list_compact(list);
+  return 1;
+}
+
+/*
+ * 정렬된 두 노드 사슬(NULL로 끝남)을 하나로 병합하는 함수 (merge_runs)
+ *  - 노드를 새로 할당하지 않고 next만 다시 연결 (prev는 link_prev가 나중에 한 번에 채움)
+ *  - 값이 같으면 a의 노드를 먼저 두므로 안정 정렬
+ *  - 병합된 사슬의 head를 반환하고, tail이 NULL이 아니면 *tail에 마지막 노드를 저장
+ *    (남은 쪽 사슬을 끝까지 따라가야 하므로 필요할 때만)
+ */
+Node *merge_runs(Node *a, Node *b, Node **tail)
+{
+  Node dummy;
+  Node *last = &dummy;
+  while (a && b)
+  {
+    if (b->data < a->data)
+    {
+      last->next = b;
+      b = b->next;
+    }
+    else
+    {
+      last->next = a;
+      a = a->next;
+    }
+    last = last->next;
+  }
+  last->next = a ? a : b;
+  if (tail)
+  {
+    while (last->next)
+      last = last->next;
+    *tail = last;
+  }
+  return dummy.next;
+}
+
+/* 병합 정렬이 쌓아 두는 정렬된 구간의 최대 단계 수 (단계 i의 구간 길이는 2^i) */
+#define SORT_RUN_SLOTS 32
+
+/*
+ * NULL로 끝나는 노드 사슬을 정렬하는 함수 (sort_chain, 상향식 병합 정렬)
+ *  1. 노드를 하나씩 떼어 길이 2^i인 정렬된 구간 runs[i]와 이진 카운터처럼 병합
+ *  2. 남은 구간들을 작은 것부터 차례로 병합해 head를 반환하고 *tail에 마지막 노드를 저장
+ *  - 추가 공간은 고정 크기 runs 배열뿐이고, 방금 병합한 구간을 바로 다시 병합하므로 캐시 효율이 좋음
+ */
+Node *sort_chain(Node *head, Node **tail)
+{
+  Node *runs[SORT_RUN_SLOTS] = {NULL};
+  while (head)
+  {
+    Node *run = head;
+    head = head->next;
+    run->next = NULL;
+    int i = 0;
+    for (; i < SORT_RUN_SLOTS - 1 && runs[i]; i++)
+    {
+      run = merge_runs(runs[i], run, NULL); /* runs[i]가 앞쪽 노드이므로 먼저 넘겨 안정성 유지 */
+      runs[i] = NULL;
+    }
+    runs[i] = run;
+  }
+
+  int top = SORT_RUN_SLOTS - 1;
+  while (top > 0 && !runs[top])
+    top--;
+  Node *sorted = NULL;
+  for (int i = 0; i <= top; i++)
+  {
+    if (runs[i])
+      sorted = merge_runs(runs[i], sorted, i == top ? tail : NULL);
+  }
+  return sorted;
+}
+
+/*
+ * NULL로 끝나는 사슬의 prev를 채우고 양 끝을 이어 원형으로 되돌리는 함수 (close_ring)
+ *  - next만 다시 연결하는 정렬/병합 뒤에 O(n) 한 번
+ */
+void close_ring(Node *head, Node *tail)
+{
+  Node *prev = tail;
+  for (Node *current = head; current; current = current->next)
+  {
+    current->prev = prev;
+    prev = current;
+  }
+  tail->next = head;
+}
+
+/*
+ * 리스트를 오름차순으로 정렬하는 함수 (list_sort, O(n log n) 시간, O(1) 추가 공간, 안정 정렬)
+ *  1. head->prev(tail)의 next를 끊어 NULL로 끝나는 사슬로 만듦
+ *  2. sort_chain으로 next만 다시 연결
+ *  3. close_ring으로 prev와 원형 연결 복원
+ *  - 노드를 옮기지 않으므로 노드 핸들은 그대로 쓸 수 있음
+ */
+void list_sort(DoublyLinkedList *list)
+{
+  if (list->size < 2)
+    return;
+
+  Node *tail;
+  list->head->prev->next = NULL;
+  list->head = sort_chain(list->head, &tail);
+  close_ring(list->head, tail);
+  list->cursor = NULL;
+}
+
+/*
+ * src의 슬랩 그룹과 free list를 dst 풀로 옮기는 함수 (pool_absorb, O(1))
+ *  - 노드는 제자리에 있고 소유권만 넘어감
+ *  - 이후 src 풀은 비어 있음
+ */
+void pool_absorb(NodePool *dst, NodePool *src)
+{
+  if (src->group)
+  {
+    SlabGroup *group = pool_group(dst);
+    group_union(group, pool_group(src));
+    group->refs--; /* src가 쓰던 참조를 놓음 */
+  }
+  if (src->free_nodes)
+  {
+    src->free_tail->next = dst->free_nodes;
+    if (!dst->free_nodes)
+      dst->free_tail = src->free_tail;
+    dst->free_nodes = src->free_nodes;
+  }
+  pool_init(src);
+}
+
+/*
+ * 정렬된 리스트 b를 정렬된 리스트 a에 병합하는 함수 (merge_sorted, O(len(a) + len(b)), 노드 할당 없음)
+ *  1. 두 원형을 끊어 NULL로 끝나는 사슬로 만듦
+ *  2. merge_runs로 b의 노드를 a 사이사이에 끼워 넣고 원형 복원
+ *  3. b의 풀을 a가 넘겨받고 b는 빈 리스트로 만듦 (b의 노드 핸들은 a의 노드로 계속 쓸 수 있음)
+ */
+void merge_sorted(DoublyLinkedList *a, DoublyLinkedList *b)
+{
+  if (is_empty(b))
+    return;
+
+  if (!is_empty(a))
+    a->head->prev->next = NULL;
+  b->head->prev->next = NULL;
+  Node *tail;
+  a->head = merge_runs(a->head, b->head, &tail);
+  close_ring(a->head, tail);
+  a->size += b->size;
+  a->cursor = NULL;
+  pool_absorb(&a->pool, &b->pool);
+  b->head = NULL;
+  b->size = 0;
+  b->cursor = NULL;
+}
+
+/*
+ * src의 모든 노드를 dst의 노드 pos 바로 뒤에 끼워 넣는 함수 (list_splice, O(1))
+ *  - pos가 NULL이면 dst의 맨 앞에 끼워 넣음 (tail 뒤에 넣고 head를 src의 첫 노드로)
+ *  - src의 양 끝(head, head->prev)만 다시 연결하므로 노드를 복사하지 않음
+ *  - src의 노드 소유권도 dst로 넘어가므로 호출 후 src는 빈 리스트 (src의 노드 핸들은 계속 쓸 수 있음)
+ */
+void list_splice(DoublyLinkedList *dst, Node *pos, DoublyLinkedList *src)
+{
+  if (is_empty(src))
+    return;
+
+  Node *first = src->head;
+  Node *last = src->head->prev;
+  if (is_empty(dst))
+  {
+    dst->head = first;
+  }
+  else
+  {
+    Node *tail = dst->head->prev;
+    Node *after = pos ? pos : tail;
+    Node *next = after->next;
+    after->next = first;
+    first->prev = after;
+    last->next = next;
+    next->prev = last;
+    if (!pos)
+    {
+      dst->head = first;
+      if (dst->cursor)
+      {
+        dst->cursor_index += src->size; /* 기존 노드의 위치가 src 크기만큼 밀림 */
+      }
+    }
+    else if (pos != tail)
+    {
+      dst->cursor = NULL; /* 중간에 끼우면 cursor 뒤쪽 위치가 바뀔 수 있으므로 cursor를 버림 */
+    }
+  }
+  dst->size += src->size;
+
+  pool_absorb(&dst->pool, &src->pool);
+  src->head = NULL;
+  src->size = 0;
+  src->cursor = NULL;
+}
+
+/*
+ * 리스트 b를 리스트 a의 끝에 잇는 함수 (list_concat, O(1))
+ *  - a의 tail(head->prev) 뒤에 b를 통째로 끼워 넣음, 호출 후 b는 빈 리스트
+ */
+void list_concat(DoublyLinkedList *a, DoublyLinkedList *b)
+{
+  list_splice(a, is_empty(a) ? NULL : a->head->prev, b);
+}
+
+/*
+ * 노드 node부터 tail까지를 떼어 새 원형 리스트로 반환하는 함수 (list_split_at)
+ *  1. node에서 앞(tail 방향)과 뒤(head 방향)로 동시에 세어, 먼저 끝나는 쪽으로 두 리스트의 크기를 구함
+ *     (O(min(k, n - k)), 연결을 바꾸는 것은 O(1))
+ *  2. head..node->prev와 node..tail을 각각 원형으로 이음
+ *  3. 새 리스트는 원래 리스트와 같은 슬랩 그룹을 함께 쓰며, 슬랩은 둘 다 해제된 뒤에 해제됨
+ */
+DoublyLinkedList list_split_at(DoublyLinkedList *list, Node *node)
+{
+  DoublyLinkedList rest;
+  init(&rest);
+
+  int front = 0; /* node 앞쪽 노드 수 */
+  int back = list->size;
+  if (node != list->head)
+  {
+    Node *forward = node;
+    Node *backward = node->prev;
+    front = 1;
+    back = 1;
+    while (forward->next != list->head && backward != list->head)
+    {
+      forward = forward->next;
+      back++;
+      backward = backward->prev;
+      front++;
+    }
+    if (forward->next == list->head)
+      front = list->size - back;
+    else
+      back = list->size - front;
+
+    Node *tail = list->head->prev;
+    Node *front_last = node->prev;
+    front_last->next = list->head;
+    list->head->prev = front_last;
+    node->prev = tail;
+    tail->next = node;
+  }
+  else
+  {
+    list->head = NULL; /* node가 head면 전체를 떼어 냄 */
+  }
+
+  rest.head = node;
+  rest.size = back;
+  list->size = front;
+  if (list->cursor && list->cursor_index >= front)
+    list->cursor = NULL; /* cursor가 떼어 낸 쪽에 있었음 */
+
+  pool_share(&rest.pool, &list->pool);
+  return rest;
+}
+
+/*
+ * search_batch/delete_batch가 키 집합을 담는 해시 테이블의 칸
+ *  - key: 키
+ *  - count: keys에 나온 횟수 (0이면 빈 칸)
+ *  - hits: 순회 중 이 키와 일치해 처리한 노드 수
+ */
+typedef struct KeySlot
+{
+  int key;
+  int count;
+  int hits;
+} KeySlot;
+
+/*
+ * 키 집합 구조체: 선형 탐사를 쓰는 개방 주소법 해시 테이블 (칸의 절반 이하만 채움)
+ *  - slots: 칸 배열
+ *  - mask: 칸 수 - 1 (칸 수는 2의 거듭제곱)
+ *  - distinct: 서로 다른 키 수
+ */
+typedef struct KeySet
+{
+  KeySlot *slots;
+  size_t mask;
+  size_t distinct;
+} KeySet;
+
+/*
+ * 키의 해시 값을 구하는 함수 (key_hash)
+ *  - 곱셈 해시 후 상위 비트를 아래로 섞음
+ */
+size_t key_hash(int key)
+{
+  uint32_t h = (uint32_t)key * 2654435761u;
+  return h ^ (h >> 16);
+}
+
+/*
+ * key가 들어 있는 칸, 없으면 key가 들어갈 빈 칸을 찾는 함수 (keyset_slot)
+ */
+KeySlot *keyset_slot(KeySet *set, int key)
+{
+  size_t i = key_hash(key) & set->mask;
+  while (set->slots[i].count > 0 && set->slots[i].key != key)
+    i = (i + 1) & set->mask;
+  return &set->slots[i];
+}
+
+/*
+ * keys의 k개 키를 한 번 해시해 키 집합을 만드는 함수 (keyset_build, O(k))
+ */
+void keyset_build(KeySet *set, const int *keys, size_t k)
+{
+  size_t capacity = 8;
+  while (capacity < 2 * k)
+    capacity *= 2;
+  set->slots = (KeySlot *)calloc(capacity, sizeof(KeySlot));
+  set->mask = capacity - 1;
+  set->distinct = 0;
+  for (size_t i = 0; i < k; i++)
+  {
+    KeySlot *slot = keyset_slot(set, keys[i]);
+    if (slot->count == 0)
+    {
+      slot->key = keys[i];
+      set->distinct++;
+    }
+    slot->count++;
+  }
+}
+
+/*
+ * 검색이 끝난 키 집합에서 keys 순서대로 결과를 채우고 집합을 해제하는 함수 (keyset_results)
+ */
+void keyset_results(KeySet *set, const int *keys, size_t k, int *results)
+{
+  for (size_t i = 0; i < k; i++)
+    results[i] = keyset_slot(set, keys[i])->hits > 0;
+  free(set->slots);
+}
+
+/*
+ * keys의 k개 키가 리스트에 있는지 한 번에 검색하는 함수 (search_batch, O(k + n))
+ *  1. 키 집합을 한 번 해시해 둠
+ *  2. head부터 한 바퀴 돌며 노드마다 해시 조회 한 번으로 일치하는 키를 표시 (모든 키를 찾으면 멈춤)
+ *  3. results[i]에 keys[i]의 존재 여부(1/0)를 기록
+ */
+void search_batch(DoublyLinkedList *list, const int *keys, size_t k, int *results)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t pending = set.distinct;
+  Node *current = list->head;
+  for (int i = 0; i < list->size && pending > 0; i++)
+  {
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->count > 0 && slot->hits == 0)
+    {
+      slot->hits = 1;
+      pending--;
+    }
+    current = current->next;
+  }
+  keyset_results(&set, keys, k, results);
+}
+
+/*
+ * keys의 각 키마다 그 값을 가진 첫 번째 노드를 한 바퀴 순회로 삭제하는 함수 (delete_batch, O(k + n))
+ *  - delete를 keys 순서대로 k번 부른 것과 결과가 같음 (같은 키가 여러 번 있으면 그 수만큼 앞에서부터 삭제)
+ *  - 삭제하면서 원형이 줄어드므로 처음 노드 수만큼만 돌고, 노드는 remove_node로 제거
+ *  - 반환값: 삭제한 노드 수
+ */
+int delete_batch(DoublyLinkedList *list, const int *keys, size_t k)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t deleted = 0;
+  int steps = list->size;
+  Node *current = list->head;
+  for (int i = 0; i < steps && deleted < k; i++)
+  {
+    Node *next = current->next; /* remove_node가 노드를 풀에 돌려주기 전에 읽어 둠 */
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->hits < slot->count)
+    {
+      slot->hits++;
+      deleted++;
+      remove_node(list, current);
+    }
+    current = next;
+  }
+  free(set.slots);
+  return (int)deleted;
 }
 
 /*
@@ -371,7 +1351,7 @@ int main()
 
   append(&dll, 10);
   append(&dll, 20);
-  append(&dll, 30);
+  Node *node30 = append(&dll, 30); // append/prepend는 노드 핸들을 반환
   show(&dll);
 
   prepend(&dll, 5);
@@ -380,6 +1360,13 @@ int main()
   delete (&dll, 20);
   show(&dll);
 
+  // 핸들 기준 O(1) 삽입/삭제
+  Node *node7 = insert_after(&dll, dll.head, 7);
+  insert_before(&dll, node30, 25);
+  show(&dll);
+  remove_node(&dll, node7);
+  show(&dll);
+
   printf("10 검색: %d\n", search(&dll, 10));
   printf("40 검색: %d\n", search(&dll, 40));
 
@@ -391,6 +1378,74 @@ int main()
   printf("중간 노드: %d\n", find_middle(&dll));
   printf("2번째 노드: %d\n", get_nth(&dll, 2));
 
+  // 반복자로 전체를 O(n)에 순회
+  for (ListIter it = list_iter_begin(&dll); !list_iter_end(&it); list_iter_next(&it))
+  {
+    printf("[%d]=%d ", it.index, it.node->data);
+  }
+  printf("\n");
+
   free_list(&dll);
+  // 배열에서 한 번에 리스트 만들기 (노드가 연속된 블록 하나에 놓임)
+  int values[] = {1, 2, 3, 4, 5};
+  DoublyLinkedList bulk = list_from_array(values, 5);
+  list_append_array(&bulk, values, 2);
+  show(&bulk);
+  // 배열로 복사 (전체와 앞쪽 2개만)
+  int snapshot[8] = {0};
+  int copied = list_to_array(&bulk, snapshot);
+  printf("배열로 복사한 개수: %d, 마지막 값: %d\n", copied, snapshot[copied - 1]);
+  copied = list_to_array_bounded(&bulk, snapshot, 2);
+  printf("부분 스냅샷: %d개 [%d, %d]\n", copied, snapshot[0], snapshot[1]);
+  // 이진 형식으로 저장했다가 다시 읽기
+  FILE *fp = tmpfile();
+  list_write(&bulk, fp);
+  rewind(fp);
+  DoublyLinkedList loaded;
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  show(&loaded);
+  free_list(&loaded);
+  // 제자리 정렬과 정렬된 두 리스트 병합 (원형 유지)
+  int unsorted[] = {42, 7, 19, 3, 25};
+  DoublyLinkedList left = list_from_array(unsorted, 5);
+  list_sort(&left);
+  show(&left);
+  int more[] = {1, 20, 50};
+  DoublyLinkedList right = list_from_array(more, 3);
+  merge_sorted(&left, &right); // right의 노드가 left로 옮겨지고 right는 빈 리스트가 됨
+  show(&left);
+  // 핸들 위치에서 O(1)로 나누고, 앞뒤를 바꿔 다시 잇기
+  Node *middle = left.head->next->next->next;
+  DoublyLinkedList back = list_split_at(&left, middle);
+  show(&left);
+  show(&back);
+  list_concat(&back, &left); // 나뉜 두 리스트는 같은 슬랩을 쓰므로 어느 쪽으로 이어도 됨
+  show(&back);
+  int extra[] = {100, 200};
+  DoublyLinkedList inserted = list_from_array(extra, 2);
+  list_splice(&back, back.head, &inserted); // head 바로 뒤에 통째로 끼워 넣기
+  show(&back);
+  printf("길이: %d, 끼워 넣은 리스트 길이: %d\n", length(&back), length(&inserted));
+  // 여러 키를 한 번의 순회로 검색하고 삭제
+  int batch_keys[] = {100, 7, 200, 100};
+  int batch_found[4];
+  search_batch(&back, batch_keys, 4, batch_found);
+  printf("한 번에 검색: 100=%d 7=%d 200=%d\n", batch_found[0], batch_found[1], batch_found[2]);
+  printf("한 번에 삭제한 노드 수: %d\n", delete_batch(&back, batch_keys, 4));
+  show(&back);
+  free_list(&back);
+  free_list(&inserted);
+  free_list(&left);
+  // prepend/delete로 흩어진 노드를 조각 모음
+  prepend(&bulk, 0);
+  delete (&bulk, 3);
+  printf("조각화: %.2f", fragmentation(&bulk));
+  list_compact(&bulk);
+  printf(" -> %.2f\n", fragmentation(&bulk));
+  show(&bulk);
+  free_list(&bulk);
+
   return 0;
 }
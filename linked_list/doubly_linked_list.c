@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
 
 // 이중 연결 리스트의 노드를 나타내는 구조체
 typedef struct Node
@@ -9,16 +12,219 @@ typedef struct Node
   struct Node *prev; // 이전 노드를 가리키는 포인터
 } Node;
 
+// 슬랩 하나에 담기는 노드 수
+#define SLAB_NODES 256
+
+// 노드 풀의 슬랩: 여러 노드를 한 번의 malloc으로 할당한 블록
+typedef struct Slab
+{
+  struct Slab *next; // 다음 슬랩
+  Node nodes[];      // 노드 배열
+} Slab;
+
+// 슬랩 그룹: 노드를 주고받은 리스트들이 함께 소유하는 슬랩 목록
+// list_split_at으로 나뉜 두 리스트는 같은 슬랩의 노드를 나눠 가지므로, 슬랩을 그룹 단위로 참조 수를 세어
+// 그룹을 쓰는 마지막 리스트가 해제될 때 한 번에 해제한다. list_concat/list_splice는 두 그룹을 O(1)에 합친다.
+typedef struct SlabGroup
+{
+  struct SlabGroup *parent;      // 다른 그룹에 합쳐졌으면 그 그룹 (대표 그룹이면 NULL)
+  struct SlabGroup *merged;      // 이 그룹에 합쳐진 그룹 목록 (대표 그룹과 함께 해제)
+  struct SlabGroup *next_merged; // merged 목록의 다음 그룹
+  Slab *slabs;                   // 할당된 슬랩 목록 (대표 그룹만 가짐)
+  Slab *last_slab;               // slabs의 마지막 슬랩, 그룹을 O(1)에 합치기 위해 유지
+  int refs;                      // 이 그룹을 쓰는 풀 수 (대표 그룹에서만 셈)
+} SlabGroup;
+
+// 노드 풀: 슬랩 그룹과 반환된 노드를 재사용하기 위한 free list
+typedef struct NodePool
+{
+  SlabGroup *group; // 슬랩을 등록하는 그룹 (처음 슬랩을 할당할 때 만듦)
+  Node *free_nodes; // 재사용 가능한 노드 목록 (next로 연결된 침습형 free list)
+  Node *free_tail;  // free list의 마지막 노드, free list를 O(1)에 넘기기 위해 유지
+} NodePool;
+
 // 이중 연결 리스트를 나타내는 구조체
 typedef struct DoublyLinkedList
 {
-  Node *head; // 리스트의 시작(head)
+  Node *head;       // 리스트의 시작(head)
+  Node *tail;       // 리스트의 끝(tail), append를 O(1)로 만들기 위해 유지
+  int size;         // 노드 수, length를 O(1)로 만들기 위해 유지
+  NodePool pool;    // 노드를 할당하는 리스트 전용 노드 풀
+  Node *cursor;     // 마지막으로 get_nth로 접근한 노드 (NULL이면 없음)
+  int cursor_index; // cursor의 위치
 } DoublyLinkedList;
 
+// 리스트를 처음부터 끝까지 O(n)에 순회하기 위한 반복자
+typedef struct ListIter
+{
+  Node *node; // 현재 노드 (끝이면 NULL)
+  int index;  // 현재 위치
+} ListIter;
+
+// 노드 풀 초기화 함수
+void pool_init(NodePool *pool)
+{
+  pool->group = NULL;
+  pool->free_nodes = NULL;
+  pool->free_tail = NULL;
+}
+
+// 풀이 속한 대표 그룹을 반환하는 함수 (없으면 새로 만듦)
+// 합쳐진 그룹은 parent를 따라 올라가고, 다음 호출이 바로 찾도록 pool->group을 대표 그룹으로 바꿔 둔다.
+SlabGroup *pool_group(NodePool *pool)
+{
+  if (!pool->group)
+  {
+    pool->group = (SlabGroup *)calloc(1, sizeof(SlabGroup));
+    pool->group->refs = 1;
+  }
+  while (pool->group->parent)
+  {
+    pool->group = pool->group->parent;
+  }
+  return pool->group;
+}
+
+// 새 슬랩을 풀의 그룹에 등록하는 함수
+void pool_add_slab(NodePool *pool, Slab *slab)
+{
+  SlabGroup *group = pool_group(pool);
+  slab->next = group->slabs;
+  group->slabs = slab;
+  if (!group->last_slab)
+  {
+    group->last_slab = slab;
+  }
+}
+
+// 풀에서 노드 하나를 꺼내는 함수 (free list가 비면 새 슬랩을 할당)
+Node *pool_alloc(NodePool *pool)
+{
+  if (!pool->free_nodes)
+  {
+    Slab *slab = (Slab *)malloc(sizeof(Slab) + SLAB_NODES * sizeof(Node));
+    pool_add_slab(pool, slab);
+    // 슬랩의 노드들을 순서대로 free list에 연결
+    for (int i = 0; i < SLAB_NODES - 1; i++)
+    {
+      slab->nodes[i].next = &slab->nodes[i + 1];
+    }
+    slab->nodes[SLAB_NODES - 1].next = NULL;
+    pool->free_nodes = &slab->nodes[0];
+    pool->free_tail = &slab->nodes[SLAB_NODES - 1];
+  }
+
+  Node *node = pool->free_nodes;
+  pool->free_nodes = node->next;
+  return node;
+}
+
+// 노드를 풀의 free list로 반환하는 함수 (free를 호출하지 않음)
+void pool_free(NodePool *pool, Node *node)
+{
+  if (!pool->free_nodes)
+  {
+    pool->free_tail = node;
+  }
+  node->next = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+// 슬랩 하나에 노드 n개를 연속으로 할당해 반환하는 함수 (free list를 거치지 않음)
+// 다른 슬랩과 함께 pool_destroy가 한 번에 해제한다.
+Node *pool_alloc_block(NodePool *pool, size_t n)
+{
+  Slab *slab = (Slab *)malloc(sizeof(Slab) + n * sizeof(Node));
+  pool_add_slab(pool, slab);
+  return slab->nodes;
+}
+
+// 대표 그룹과 그 그룹에 합쳐진 그룹들을 슬랩과 함께 해제하는 함수 (재귀 없이 목록을 펼쳐 가며 해제)
+void group_free(SlabGroup *group)
+{
+  group->next_merged = NULL;
+  SlabGroup *pending = group;
+  while (pending)
+  {
+    SlabGroup *current = pending;
+    pending = current->next_merged;
+    for (SlabGroup *child = current->merged, *next; child; child = next)
+    {
+      next = child->next_merged;
+      child->next_merged = pending;
+      pending = child;
+    }
+
+    Slab *slab = current->slabs;
+    Slab *next;
+    while (slab)
+    {
+      next = slab->next;
+      free(slab);
+      slab = next;
+    }
+    free(current);
+  }
+}
+
+// 풀을 해제하는 함수 (그룹을 쓰는 마지막 풀이면 그룹의 모든 슬랩을 해제, 노드 수가 아니라 슬랩 수만큼만 반복)
+void pool_destroy(NodePool *pool)
+{
+  if (pool->group)
+  {
+    SlabGroup *group = pool_group(pool);
+    if (--group->refs == 0)
+    {
+      group_free(group);
+    }
+  }
+  pool_init(pool);
+}
+
+// 대표 그룹 from을 대표 그룹 into에 합치는 함수 (O(1), from의 슬랩과 참조 수가 into로 옮겨감)
+void group_union(SlabGroup *into, SlabGroup *from)
+{
+  if (into == from)
+  {
+    return;
+  }
+
+  from->parent = into;
+  into->refs += from->refs;
+  if (from->slabs)
+  {
+    from->last_slab->next = into->slabs;
+    into->slabs = from->slabs;
+    if (!into->last_slab)
+    {
+      into->last_slab = from->last_slab;
+    }
+  }
+  from->slabs = NULL;
+  from->last_slab = NULL;
+  from->next_merged = into->merged;
+  into->merged = from;
+}
+
+// dst 풀이 src 풀의 슬랩 그룹을 함께 쓰게 하는 함수 (list_split_at이 노드를 나눠 줄 때, 참조 수만 늘림)
+void pool_share(NodePool *dst, NodePool *src)
+{
+  if (src->group)
+  {
+    dst->group = pool_group(src);
+    dst->group->refs++;
+  }
+}
+
 // 리스트 초기화 함수
 void init(DoublyLinkedList *list)
 {
   list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  pool_init(&list->pool);
+  list->cursor = NULL;
+  list->cursor_index = 0;
 }
 
 // 리스트가 비어 있는지 확인하는 함수
@@ -27,10 +233,10 @@ int is_empty(DoublyLinkedList *list)
   return list->head == NULL;
 }
 
-// 리스트의 끝에 새 노드를 추가하는 함수
-void append(DoublyLinkedList *list, int data)
+// 리스트의 끝에 새 노드를 추가하는 함수 (추가된 노드를 핸들로 반환)
+Node *append(DoublyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = NULL;
   new_node->prev = NULL;
@@ -38,22 +244,59 @@ void append(DoublyLinkedList *list, int data)
   if (is_empty(list))
   {
     list->head = new_node;
+  }
+  else
+  {
+    list->tail->next = new_node; // tail을 유지하므로 끝까지 순회할 필요 없음
+    new_node->prev = list->tail;
+  }
+  list->tail = new_node;
+  list->size++;
+  return new_node;
+}
+
+// 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수
+// n개의 노드를 연속된 블록 하나에서 순회 순서대로 꺼내므로, 이후 순회는 메모리를 순서대로 읽는다.
+void list_append_array(DoublyLinkedList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+  {
     return;
   }
 
-  Node *current = list->head;
-  while (current->next)
+  Node *nodes = pool_alloc_block(&list->pool, n);
+  for (size_t i = 0; i < n; i++)
   {
-    current = current->next;
+    nodes[i].data = vals[i];
+    nodes[i].next = (i + 1 < n) ? &nodes[i + 1] : NULL;
+    nodes[i].prev = (i > 0) ? &nodes[i - 1] : list->tail;
+  }
+
+  if (is_empty(list))
+  {
+    list->head = &nodes[0];
+  }
+  else
+  {
+    list->tail->next = &nodes[0];
   }
-  current->next = new_node;
-  new_node->prev = current;
+  list->tail = &nodes[n - 1];
+  list->size += (int)n;
 }
 
-// 리스트의 시작에 새 노드를 추가하는 함수
-void prepend(DoublyLinkedList *list, int data)
+// 배열로 새 리스트를 만드는 함수 (append를 n번 호출하는 대신 할당 한 번)
+DoublyLinkedList list_from_array(const int *vals, size_t n)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  DoublyLinkedList list;
+  init(&list);
+  list_append_array(&list, vals, n);
+  return list;
+}
+
+// 리스트의 시작에 새 노드를 추가하는 함수 (추가된 노드를 핸들로 반환)
+Node *prepend(DoublyLinkedList *list, int data)
+{
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = list->head;
   new_node->prev = NULL;
@@ -62,8 +305,72 @@ void prepend(DoublyLinkedList *list, int data)
   {
     list->head->prev = new_node;
   }
+  else
+  {
+    list->tail = new_node;
+  }
 
   list->head = new_node;
+  list->size++;
+  if (list->cursor)
+  {
+    list->cursor_index++; // 모든 노드의 위치가 한 칸씩 밀림
+  }
+  return new_node;
+}
+
+// 노드 핸들 바로 뒤에 새 노드를 삽입하는 함수 (검색 없이 O(1))
+Node *insert_after(DoublyLinkedList *list, Node *node, int data)
+{
+  if (node == list->tail)
+  {
+    return append(list, data);
+  }
+
+  Node *new_node = pool_alloc(&list->pool);
+  new_node->data = data;
+  new_node->prev = node;
+  new_node->next = node->next;
+  node->next->prev = new_node;
+  node->next = new_node;
+  list->size++;
+  list->cursor = NULL; // 위치가 바뀔 수 있으므로 cursor를 버림
+  return new_node;
+}
+
+// 노드 핸들 바로 앞에 새 노드를 삽입하는 함수 (검색 없이 O(1))
+Node *insert_before(DoublyLinkedList *list, Node *node, int data)
+{
+  if (node == list->head)
+  {
+    return prepend(list, data);
+  }
+  return insert_after(list, node->prev, data);
+}
+
+// 노드 핸들이 가리키는 노드를 삭제하는 함수 (검색 없이 O(1))
+void remove_node(DoublyLinkedList *list, Node *node)
+{
+  if (node->prev)
+  {
+    node->prev->next = node->next;
+  }
+  else
+  {
+    list->head = node->next;
+  }
+
+  if (node->next)
+  {
+    node->next->prev = node->prev;
+  }
+  else
+  {
+    list->tail = node->prev;
+  }
+  pool_free(&list->pool, node);
+  list->size--;
+  list->cursor = NULL; // 위치가 바뀔 수 있으므로 cursor를 버림
 }
 
 // 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
@@ -81,20 +388,7 @@ void delete(DoublyLinkedList *list, int data)
   {
     if (current->data == data)
     {
-      if (current->prev)
-      {
-        current->prev->next = current->next;
-      }
-      else
-      {
-        list->head = current->next;
-      }
-
-      if (current->next)
-      {
-        current->next->prev = current->prev;
-      }
-      free(current);
+      remove_node(list, current);
       return;
     }
     current = current->next;
@@ -141,6 +435,7 @@ void reverse(DoublyLinkedList *list)
   Node *current = list->head;
   Node *temp = NULL;
 
+  list->tail = list->head; // 기존 head가 뒤집힌 후의 tail
   while (current)
   {
     temp = current->prev;
@@ -153,19 +448,16 @@ void reverse(DoublyLinkedList *list)
   {
     list->head = temp->prev;
   }
+  if (list->cursor)
+  {
+    list->cursor_index = list->size - 1 - list->cursor_index; // cursor 노드의 위치가 뒤집힘
+  }
 }
 
 // 리스트의 노드 수를 계산하는 함수
 int length(DoublyLinkedList *list)
 {
-  int count = 0;
-  Node *current = list->head;
-  while (current)
-  {
-    count++;
-    current = current->next;
-  }
-  return count;
+  return list->size;
 }
 
 // 리스트의 중간 노드를 찾는 함수
@@ -183,36 +475,616 @@ int find_middle(DoublyLinkedList *list)
 }
 
 // 리스트에서 N번째 노드 데이터를 찾는 함수
+// head, tail, 마지막으로 접근한 위치(cursor) 중 가장 가까운 곳에서 앞/뒤로 이동
+// (i = 0..n-1 순서로 호출해도 전체 O(n))
 int get_nth(DoublyLinkedList *list, int n)
 {
+  if (n < 0 || n >= list->size)
+  {
+    printf("인덱스가 범위를 벗어났습니다.\n");
+    return -1;
+  }
+
   Node *current = list->head;
   int count = 0;
+  int distance = n;
+  if (list->size - 1 - n < distance)
+  {
+    current = list->tail;
+    count = list->size - 1;
+    distance = list->size - 1 - n;
+  }
+  if (list->cursor && abs(n - list->cursor_index) < distance)
+  {
+    current = list->cursor;
+    count = list->cursor_index;
+  }
+  while (count < n)
+  {
+    current = current->next;
+    count++;
+  }
+  while (count > n)
+  {
+    current = current->prev;
+    count--;
+  }
 
-  while (current)
+  list->cursor = current;
+  list->cursor_index = n;
+  return current->data;
+}
+
+// 메모리 해제 함수 (노드를 하나씩 free하지 않고 풀의 슬랩을 통째로 해제)
+void free_list(DoublyLinkedList *list)
+{
+  pool_destroy(&list->pool);
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  list->cursor = NULL;
+  list->cursor_index = 0;
+}
+
+// 반복자를 첫 노드에 두는 함수
+ListIter list_iter_begin(DoublyLinkedList *list)
+{
+  ListIter it = {list->head, 0};
+  return it;
+}
+
+// 반복자가 끝에 도달했는지 확인하는 함수
+int list_iter_end(ListIter *it)
+{
+  return it->node == NULL;
+}
+
+// 반복자를 다음 노드로 옮기는 함수
+void list_iter_next(ListIter *it)
+{
+  it->node = it->node->next;
+  it->index++;
+}
+
+// 리스트의 데이터를 앞에서부터 최대 max개까지 out 배열에 복사하는 함수 (부분 스냅샷)
+// 실제로 복사한 개수를 반환한다.
+int list_to_array_bounded(DoublyLinkedList *list, int *out, int max)
+{
+  int count = list->size < max ? list->size : max;
+  Node *current = list->head;
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = current->data;
+    current = current->next;
+  }
+  return count;
+}
+
+// 리스트의 모든 데이터를 out 배열에 순서대로 복사하는 함수 (out은 length(list)개 이상)
+int list_to_array(DoublyLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+// 직렬화 형식을 확인하는 값과 형식 버전
+#define LIST_MAGIC "DSAL"
+#define LIST_FORMAT_VERSION 1
+// list_read가 한 번에 모아 list_append_array로 붙이는 데이터 수
+#define LIST_READ_CHUNK 4096
+
+// 부호 있는 차이를 작은 양수로 바꾸는 함수 (zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+uint64_t zigzag_encode(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t zigzag_decode(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// 7비트씩 나눠 기록하는 가변 길이 정수(varint)를 쓰는 함수 (작은 값일수록 짧음)
+void write_varint(FILE *fp, uint64_t v)
+{
+  while (v >= 0x80)
   {
-    if (count == n)
+    putc((int)(v & 0x7F) | 0x80, fp);
+    v >>= 7;
+  }
+  putc((int)v, fp);
+}
+
+// varint를 읽는 함수 (성공하면 0, 파일이 끝났거나 형식이 틀리면 -1)
+int read_varint(FILE *fp, uint64_t *out)
+{
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    int c = getc(fp);
+    if (c == EOF)
     {
-      return current->data;
+      return -1;
+    }
+    v |= (uint64_t)(c & 0x7F) << shift;
+    if (!(c & 0x80))
+    {
+      *out = v;
+      return 0;
     }
-    count++;
-    current = current->next;
   }
-  printf("인덱스가 범위를 벗어났습니다.\n");
   return -1;
 }
 
-// 메모리 해제 함수
-void free_list(DoublyLinkedList *list)
+// 리스트를 이진 형식으로 기록하는 함수 (성공하면 0)
+// 형식: "DSAL" | 버전(1바이트) | 노드 수(varint) | 앞 데이터와의 차이(zigzag varint) x 노드 수
+// 노드를 하나씩 스트림에 쓰므로 리스트 크기와 관계없이 추가 메모리를 쓰지 않는다.
+int list_write(DoublyLinkedList *list, FILE *fp)
 {
+  fwrite(LIST_MAGIC, 1, 4, fp);
+  putc(LIST_FORMAT_VERSION, fp);
+  write_varint(fp, (uint64_t)list->size);
+
+  int64_t prev = 0;
   Node *current = list->head;
-  Node *next;
-  while (current)
+  for (int i = 0; i < list->size; i++)
   {
-    next = current->next;
-    free(current);
+    write_varint(fp, zigzag_encode((int64_t)current->data - prev));
+    prev = current->data;
+    current = current->next;
+  }
+  return ferror(fp) ? -1 : 0;
+}
+
+// list_write로 기록한 리스트를 읽어 list의 끝에 추가하는 함수 (성공하면 0)
+// LIST_READ_CHUNK개씩 모아 list_append_array로 붙이므로 파일 전체를 메모리에 올리지 않는다.
+int list_read(DoublyLinkedList *list, FILE *fp)
+{
+  char magic[4];
+  uint64_t count;
+  if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LIST_MAGIC, 4) != 0 ||
+      getc(fp) != LIST_FORMAT_VERSION || read_varint(fp, &count) != 0)
+  {
+    printf("리스트 파일 형식이 맞지 않습니다.\n");
+    return -1;
+  }
+
+  int buffer[LIST_READ_CHUNK];
+  int filled = 0;
+  int64_t prev = 0;
+  for (uint64_t i = 0; i < count; i++)
+  {
+    uint64_t v;
+    if (read_varint(fp, &v) != 0)
+    {
+      list_append_array(list, buffer, filled); // 읽은 데까지는 붙여 둠
+      printf("리스트 파일이 중간에 끝났습니다.\n");
+      return -1;
+    }
+    prev += zigzag_decode(v);
+    buffer[filled++] = (int)prev;
+    if (filled == LIST_READ_CHUNK)
+    {
+      list_append_array(list, buffer, filled);
+      filled = 0;
+    }
+  }
+  list_append_array(list, buffer, filled);
+  return 0;
+}
+
+// 노드들이 메모리에 얼마나 흩어져 있는지 구하는 함수 (0.0 ~ 1.0)
+// 순회 중 다음 노드가 메모리상 바로 옆 칸이 아닌 경우의 비율. list_compact 직후에는 0이다.
+double fragmentation(DoublyLinkedList *list)
+{
+  if (list->size < 2)
+  {
+    return 0.0;
+  }
+
+  int scattered = 0;
+  for (Node *current = list->head; current->next; current = current->next)
+  {
+    if (current->next != current + 1)
+    {
+      scattered++;
+    }
+  }
+  return (double)scattered / (list->size - 1);
+}
+
+// 모든 노드를 새 연속 블록 하나에 순회 순서대로 다시 배치하는 함수 (조각 모음)
+// 이전 슬랩은 모두 해제되므로, append/insert_after 등이 반환한 노드 핸들은 더 이상 쓸 수 없다.
+void list_compact(DoublyLinkedList *list)
+{
+  NodePool fresh;
+  pool_init(&fresh);
+  if (list->size > 0)
+  {
+    int n = list->size;
+    Node *nodes = pool_alloc_block(&fresh, n);
+    Node *current = list->head;
+    for (int i = 0; i < n; i++)
+    {
+      nodes[i].data = current->data;
+      nodes[i].next = (i + 1 < n) ? &nodes[i + 1] : NULL;
+      nodes[i].prev = (i > 0) ? &nodes[i - 1] : NULL;
+      current = current->next;
+    }
+    list->head = &nodes[0];
+    list->tail = &nodes[n - 1];
+    if (list->cursor)
+    {
+      list->cursor = &nodes[list->cursor_index]; // 위치는 그대로이므로 새 노드로 옮김
+    }
+  }
+  pool_destroy(&list->pool);
+  list->pool = fresh;
+}
+
+// 조각화 정도가 threshold 이상이면 list_compact를 수행하는 함수 (수행했으면 1)
+// 조각화 측정이 O(n)이므로 연산마다가 아니라 주기적으로(예: 유휴 시간, 일정 횟수의 삭제 후) 호출한다.
+int list_compact_if_fragmented(DoublyLinkedList *list, double threshold)
+{
+  if (fragmentation(list) < threshold)
+  {
+    return 0;
+  }
+  list_compact(list);
+  return 1;
+}
+
+// 정렬된 두 노드 사슬(NULL로 끝남)을 하나로 병합하는 함수 (노드를 새로 할당하지 않고 next만 다시 연결)
+// 값이 같으면 a의 노드를 먼저 두므로 안정 정렬이 된다. 병합된 사슬의 head를 반환하고,
+// tail이 NULL이 아니면 *tail에 마지막 노드를 저장한다 (남은 쪽 사슬을 끝까지 따라가야 하므로 필요할 때만).
+Node *merge_runs(Node *a, Node *b, Node **tail)
+{
+  Node dummy;
+  Node *last = &dummy;
+  while (a && b)
+  {
+    if (b->data < a->data)
+    {
+      last->next = b;
+      b = b->next;
+    }
+    else
+    {
+      last->next = a;
+      a = a->next;
+    }
+    last = last->next;
+  }
+  last->next = a ? a : b;
+  if (tail)
+  {
+    while (last->next)
+    {
+      last = last->next;
+    }
+    *tail = last;
+  }
+  return dummy.next;
+}
+
+// 병합 정렬이 쌓아 두는 정렬된 구간의 최대 단계 수 (단계 i의 구간 길이는 2^i, int 범위의 노드 수를 모두 담음)
+#define SORT_RUN_SLOTS 32
+
+// NULL로 끝나는 노드 사슬을 정렬해 head를 반환하고 *tail에 마지막 노드를 저장하는 함수
+// 상향식 병합 정렬: 노드를 하나씩 떼어 길이 2^i인 정렬된 구간 runs[i]와 이진 카운터처럼 병합한다.
+// 추가 공간은 고정 크기 runs 배열뿐이고, 방금 병합한 구간을 바로 다시 병합하므로 캐시에 남은 노드를 다시 읽는다.
+Node *sort_chain(Node *head, Node **tail)
+{
+  Node *runs[SORT_RUN_SLOTS] = {NULL};
+  while (head)
+  {
+    Node *run = head;
+    head = head->next;
+    run->next = NULL;
+    int i = 0;
+    for (; i < SORT_RUN_SLOTS - 1 && runs[i]; i++)
+    {
+      run = merge_runs(runs[i], run, NULL); // runs[i]가 앞쪽 노드이므로 먼저 넘겨 안정성 유지
+      runs[i] = NULL;
+    }
+    runs[i] = run;
+  }
+
+  int top = SORT_RUN_SLOTS - 1;
+  while (top > 0 && !runs[top])
+  {
+    top--;
+  }
+  Node *sorted = NULL;
+  for (int i = 0; i <= top; i++)
+  {
+    if (runs[i])
+    {
+      sorted = merge_runs(runs[i], sorted, i == top ? tail : NULL); // 마지막 병합에서만 tail을 구함
+    }
+  }
+  return sorted;
+}
+
+// next를 따라가며 prev를 다시 채우는 함수 (next만 다시 연결하는 정렬/병합 뒤에 O(n) 한 번)
+void link_prev(Node *head)
+{
+  Node *prev = NULL;
+  for (Node *current = head; current; current = current->next)
+  {
+    current->prev = prev;
+    prev = current;
+  }
+}
+
+// 리스트를 오름차순으로 정렬하는 함수 (O(n log n) 시간, O(1) 추가 공간, 안정 정렬)
+// 노드를 옮기지 않고 다시 연결만 하므로 append/insert_after 등이 반환한 노드 핸들은 그대로 쓸 수 있다.
+void list_sort(DoublyLinkedList *list)
+{
+  if (list->size < 2)
+  {
+    return;
+  }
+
+  list->head = sort_chain(list->head, &list->tail);
+  link_prev(list->head);
+  list->cursor = NULL; // 노드의 위치가 바뀌므로 cursor를 버림
+}
+
+// src의 슬랩 그룹과 free list를 dst 풀로 옮기는 함수 (O(1), 노드는 제자리에 있고 소유권만 넘어감)
+// 이후 src 풀은 비어 있다.
+void pool_absorb(NodePool *dst, NodePool *src)
+{
+  if (src->group)
+  {
+    SlabGroup *group = pool_group(dst);
+    group_union(group, pool_group(src));
+    group->refs--; // src가 쓰던 참조를 놓음
+  }
+  if (src->free_nodes)
+  {
+    src->free_tail->next = dst->free_nodes;
+    if (!dst->free_nodes)
+    {
+      dst->free_tail = src->free_tail;
+    }
+    dst->free_nodes = src->free_nodes;
+  }
+  pool_init(src);
+}
+
+// src의 모든 노드를 dst의 노드 pos 바로 뒤에 끼워 넣는 함수 (O(1), pos가 NULL이면 dst의 맨 앞)
+// 노드를 복사하지 않고 양 끝의 연결만 바꾼다. src의 노드 소유권도 dst로 넘어가므로 호출 후 src는 빈 리스트이고,
+// src의 노드 핸들은 dst의 노드로 계속 쓸 수 있다.
+void list_splice(DoublyLinkedList *dst, Node *pos, DoublyLinkedList *src)
+{
+  if (is_empty(src))
+  {
+    return;
+  }
+
+  Node *next = pos ? pos->next : dst->head;
+  src->head->prev = pos;
+  src->tail->next = next;
+  if (pos)
+  {
+    pos->next = src->head;
+  }
+  else
+  {
+    dst->head = src->head;
+    if (dst->cursor)
+    {
+      dst->cursor_index += src->size; // 기존 노드의 위치가 src 크기만큼 밀림
+    }
+  }
+  if (next)
+  {
+    next->prev = src->tail;
+    if (pos)
+    {
+      dst->cursor = NULL; // 중간에 끼우면 cursor 뒤쪽 위치가 바뀔 수 있으므로 cursor를 버림
+    }
+  }
+  else
+  {
+    dst->tail = src->tail;
+  }
+  dst->size += src->size;
+
+  pool_absorb(&dst->pool, &src->pool);
+  src->head = NULL;
+  src->tail = NULL;
+  src->size = 0;
+  src->cursor = NULL;
+}
+
+// 리스트 b를 리스트 a의 끝에 잇는 함수 (O(1), 호출 후 b는 빈 리스트)
+void list_concat(DoublyLinkedList *a, DoublyLinkedList *b)
+{
+  list_splice(a, a->tail, b);
+}
+
+// 노드 node부터 끝까지를 떼어 새 리스트로 반환하는 함수 (노드를 복사하거나 옮기지 않음)
+// 연결을 끊는 것은 O(1)이고, 두 리스트의 크기는 node에서 앞뒤로 동시에 세어 먼저 끝나는 쪽으로 구하므로
+// O(min(k, n - k))다. 두 리스트는 같은 슬랩 그룹을 함께 쓰며, 슬랩은 둘 다 해제된 뒤에 해제된다.
+DoublyLinkedList list_split_at(DoublyLinkedList *list, Node *node)
+{
+  DoublyLinkedList rest;
+  init(&rest);
+
+  int front = 0; // node 앞쪽 노드 수
+  int back = 0;  // node부터 끝까지의 노드 수
+  Node *forward = node;
+  Node *backward = node->prev;
+  while (forward && backward)
+  {
+    back++;
+    forward = forward->next;
+    front++;
+    backward = backward->prev;
+  }
+  if (!forward)
+  {
+    front = list->size - back;
+  }
+  else
+  {
+    back = list->size - front;
+  }
+
+  rest.head = node;
+  rest.tail = list->tail;
+  rest.size = back;
+  list->tail = node->prev;
+  if (list->tail)
+  {
+    list->tail->next = NULL;
+  }
+  else
+  {
+    list->head = NULL;
+  }
+  node->prev = NULL;
+  list->size = front;
+  if (list->cursor && list->cursor_index >= front)
+  {
+    list->cursor = NULL; // cursor가 떼어 낸 쪽에 있었음
+  }
+
+  pool_share(&rest.pool, &list->pool);
+  return rest;
+}
+
+// 정렬된 리스트 b를 정렬된 리스트 a에 병합하는 함수 (O(len(a) + len(b)), 노드 할당 없음)
+// b의 노드를 a 사이사이에 그대로 끼워 넣고 b의 풀도 a가 넘겨받으므로, 호출 후 b는 빈 리스트다.
+// b의 노드 핸들은 이제 a의 노드로 계속 쓸 수 있다.
+void merge_sorted(DoublyLinkedList *a, DoublyLinkedList *b)
+{
+  if (is_empty(b))
+  {
+    return;
+  }
+
+  a->head = merge_runs(a->head, b->head, &a->tail);
+  link_prev(a->head);
+  a->size += b->size;
+  a->cursor = NULL;
+  pool_absorb(&a->pool, &b->pool);
+  b->head = NULL;
+  b->tail = NULL;
+  b->size = 0;
+  b->cursor = NULL;
+}
+
+// search_batch/delete_batch가 키 집합을 담는 해시 테이블의 칸
+typedef struct KeySlot
+{
+  int key;   // 키
+  int count; // keys에 나온 횟수 (0이면 빈 칸)
+  int hits;  // 순회 중 이 키와 일치해 처리한 노드 수
+} KeySlot;
+
+// 키 집합: 선형 탐사를 쓰는 개방 주소법 해시 테이블 (칸의 절반 이하만 채움)
+typedef struct KeySet
+{
+  KeySlot *slots;  // 칸 배열
+  size_t mask;     // 칸 수 - 1 (칸 수는 2의 거듭제곱)
+  size_t distinct; // 서로 다른 키 수
+} KeySet;
+
+// 키의 해시 값 (곱셈 해시 후 상위 비트를 아래로 섞음)
+size_t key_hash(int key)
+{
+  uint32_t h = (uint32_t)key * 2654435761u;
+  return h ^ (h >> 16);
+}
+
+// key가 들어 있는 칸, 없으면 key가 들어갈 빈 칸을 찾는 함수
+KeySlot *keyset_slot(KeySet *set, int key)
+{
+  size_t i = key_hash(key) & set->mask;
+  while (set->slots[i].count > 0 && set->slots[i].key != key)
+  {
+    i = (i + 1) & set->mask;
+  }
+  return &set->slots[i];
+}
+
+// keys의 k개 키를 한 번 해시해 키 집합을 만드는 함수 (O(k))
+void keyset_build(KeySet *set, const int *keys, size_t k)
+{
+  size_t capacity = 8;
+  while (capacity < 2 * k)
+  {
+    capacity *= 2;
+  }
+  set->slots = (KeySlot *)calloc(capacity, sizeof(KeySlot));
+  set->mask = capacity - 1;
+  set->distinct = 0;
+  for (size_t i = 0; i < k; i++)
+  {
+    KeySlot *slot = keyset_slot(set, keys[i]);
+    if (slot->count == 0)
+    {
+      slot->key = keys[i];
+      set->distinct++;
+    }
+    slot->count++;
+  }
+}
+
+// 검색이 끝난 키 집합에서 keys 순서대로 결과를 채우고 집합을 해제하는 함수
+void keyset_results(KeySet *set, const int *keys, size_t k, int *results)
+{
+  for (size_t i = 0; i < k; i++)
+  {
+    results[i] = keyset_slot(set, keys[i])->hits > 0;
+  }
+  free(set->slots);
+}
+
+// keys의 k개 키가 리스트에 있는지 한 번의 순회로 검색해 results[i]에 1/0을 기록하는 함수 (O(k + n))
+// 키를 미리 해시해 두므로 노드마다 해시 조회 한 번으로 끝나고, 모든 키를 찾으면 순회를 멈춘다.
+void search_batch(DoublyLinkedList *list, const int *keys, size_t k, int *results)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t pending = set.distinct;
+  for (Node *current = list->head; current && pending > 0; current = current->next)
+  {
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->count > 0 && slot->hits == 0)
+    {
+      slot->hits = 1;
+      pending--;
+    }
+  }
+  keyset_results(&set, keys, k, results);
+}
+
+// keys의 각 키마다 그 값을 가진 첫 번째 노드를 한 번의 순회로 삭제하는 함수 (O(k + n))
+// delete를 keys 순서대로 k번 부른 것과 결과가 같다. 같은 키가 여러 번 있으면 그 수만큼 앞에서부터 삭제한다.
+// 반환값: 삭제한 노드 수
+int delete_batch(DoublyLinkedList *list, const int *keys, size_t k)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t deleted = 0;
+  Node *current = list->head;
+  while (current && deleted < k)
+  {
+    Node *next = current->next; // remove_node가 노드를 풀에 돌려주기 전에 읽어 둠
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->hits < slot->count)
+    {
+      slot->hits++;
+      deleted++;
+      remove_node(list, current);
+    }
     current = next;
   }
-  list->head = NULL;
+  free(set.slots);
+  return (int)deleted;
 }
 
 // 사용 예제
@@ -222,12 +1094,17 @@ int main()
   init(&dll);
   append(&dll, 10);
   append(&dll, 20);
-  append(&dll, 30);
+  Node *node30 = append(&dll, 30); // append/prepend는 노드 핸들을 반환
   show(&dll);
   prepend(&dll, 5);
   show(&dll);
   delete (&dll, 20);
   show(&dll);
+  Node *node7 = insert_after(&dll, dll.head, 7); // 핸들 기준 O(1) 삽입
+  insert_before(&dll, node30, 25);
+  show(&dll);
+  remove_node(&dll, node7); // 핸들로 검색 없이 O(1) 삭제
+  show(&dll);
   printf("10 검색: %d\n", search(&dll, 10));
   printf("40 검색: %d\n", search(&dll, 40));
   printf("리스트 길이: %d\n", length(&dll));
@@ -235,6 +1112,165 @@ int main()
   show(&dll);
   printf("중간 노드: %d\n", find_middle(&dll));
   printf("2번째 노드: %d\n", get_nth(&dll, 2));
+  // 반복자로 전체를 O(n)에 순회
+  for (ListIter it = list_iter_begin(&dll); !list_iter_end(&it); list_iter_next(&it))
+  {
+    printf("[%d]=%d ", it.index, it.node->data);
+  }
+  printf("\n");
   free_list(&dll);
+  // 배열에서 한 번에 리스트 만들기 (노드가 연속된 블록 하나에 놓임)
+  int values[] = {1, 2, 3, 4, 5};
+  DoublyLinkedList bulk = list_from_array(values, 5);
+  list_append_array(&bulk, values, 2);
+  show(&bulk);
+  // 배열로 복사 (전체와 앞쪽 2개만)
+  int snapshot[8] = {0};
+  int copied = list_to_array(&bulk, snapshot);
+  printf("배열로 복사한 개수: %d, 마지막 값: %d\n", copied, snapshot[copied - 1]);
+  copied = list_to_array_bounded(&bulk, snapshot, 2);
+  printf("부분 스냅샷: %d개 [%d, %d]\n", copied, snapshot[0], snapshot[1]);
+  // 이진 형식으로 저장했다가 다시 읽기
+  FILE *fp = tmpfile();
+  list_write(&bulk, fp);
+  rewind(fp);
+  DoublyLinkedList loaded;
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  show(&loaded);
+  free_list(&loaded);
+  free_list(&bulk);
+  // 제자리 정렬과 정렬된 두 리스트 병합
+  int unsorted[] = {42, 7, 19, 3, 25};
+  DoublyLinkedList left = list_from_array(unsorted, 5);
+  list_sort(&left);
+  show(&left);
+  int more[] = {1, 20, 50};
+  DoublyLinkedList right = list_from_array(more, 3);
+  merge_sorted(&left, &right); // right의 노드가 left로 옮겨지고 right는 빈 리스트가 됨
+  show(&left);
+  // 핸들 위치에서 O(1)로 나누고, 앞뒤를 바꿔 다시 잇기
+  Node *middle = left.head->next->next->next;
+  DoublyLinkedList back = list_split_at(&left, middle);
+  show(&left);
+  show(&back);
+  list_concat(&back, &left); // 나뉜 두 리스트는 같은 슬랩을 쓰므로 어느 쪽으로 이어도 됨
+  show(&back);
+  int extra[] = {100, 200};
+  DoublyLinkedList inserted = list_from_array(extra, 2);
+  list_splice(&back, back.head, &inserted); // head 바로 뒤에 통째로 끼워 넣기
+  show(&back);
+  printf("길이: %d, 끼워 넣은 리스트 길이: %d\n", length(&back), length(&inserted));
+  // 여러 키를 한 번의 순회로 검색하고 삭제
+  int batch_keys[] = {100, 7, 200, 100};
+  int batch_found[4];
+  search_batch(&back, batch_keys, 4, batch_found);
+  printf("한 번에 검색: 100=%d 7=%d 200=%d\n", batch_found[0], batch_found[1], batch_found[2]);
+  printf("한 번에 삭제한 노드 수: %d\n", delete_batch(&back, batch_keys, 4));
+  show(&back);
+  free_list(&back);
+  free_list(&inserted);
+  free_list(&left);
+
+  // 조각 모음 전후 순회 속도 비교
+  // 노드를 무작위 순서로 반환한 뒤 다시 추가하면, free list에서 꺼낸 노드들이 메모리에 흩어진다.
+  int n = 1000000;
+  DoublyLinkedList big;
+  init(&big);
+  Node **handles = (Node **)malloc(n * sizeof(Node *));
+  for (int i = 0; i < n; i++)
+  {
+    handles[i] = append(&big, i);
+  }
+  unsigned state = 2463534242u;
+  for (int i = n - 1; i > 0; i--)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    int j = (int)(state % (unsigned)(i + 1));
+    Node *temp = handles[i];
+    handles[i] = handles[j];
+    handles[j] = temp;
+  }
+  for (int i = 0; i < n; i++)
+  {
+    remove_node(&big, handles[i]);
+  }
+  free(handles);
+  for (int i = 0; i < n; i++)
+  {
+    append(&big, i);
+  }
+
+  int scans = 5;
+  double before_frag = fragmentation(&big);
+  clock_t start = clock();
+  for (int i = 0; i < scans; i++)
+  {
+    search(&big, -1); // 없는 값: 전체 순회
+  }
+  double before = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  list_compact_if_fragmented(&big, 0.5);
+  start = clock();
+  for (int i = 0; i < scans; i++)
+  {
+    search(&big, -1);
+  }
+  double after = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+  printf("%d개 순회: 조각화 %.2f일 때 %.4f초, 조각 모음 후(%.2f) %.4f초\n",
+         n, before_frag, before, fragmentation(&big), after);
+  free_list(&big);
+
+  // 노드 할당/반환 반복 비교: 노드 풀 vs malloc/free
+  // 살아 있는 노드 4096개 중 하나를 무작위로 반환하고 새로 할당하기를 10M번 반복한다.
+  int live = 4096;
+  int churn = 10000000;
+  Node **live_nodes = (Node **)malloc(live * sizeof(Node *));
+  unsigned churn_state = 88172645u;
+  NodePool churn_pool;
+  pool_init(&churn_pool);
+  for (int i = 0; i < live; i++)
+  {
+    live_nodes[i] = pool_alloc(&churn_pool);
+  }
+  clock_t churn_start = clock();
+  for (int r = 0; r < churn; r++)
+  {
+    churn_state ^= churn_state << 13;
+    churn_state ^= churn_state >> 17;
+    churn_state ^= churn_state << 5;
+    int j = (int)(churn_state % (unsigned)live);
+    pool_free(&churn_pool, live_nodes[j]);
+    live_nodes[j] = pool_alloc(&churn_pool);
+    live_nodes[j]->data = r;
+  }
+  double pool_time = (double)(clock() - churn_start) / CLOCKS_PER_SEC;
+  pool_destroy(&churn_pool);
+
+  for (int i = 0; i < live; i++)
+  {
+    live_nodes[i] = (Node *)malloc(sizeof(Node));
+  }
+  churn_start = clock();
+  for (int r = 0; r < churn; r++)
+  {
+    churn_state ^= churn_state << 13;
+    churn_state ^= churn_state >> 17;
+    churn_state ^= churn_state << 5;
+    int j = (int)(churn_state % (unsigned)live);
+    free(live_nodes[j]);
+    live_nodes[j] = (Node *)malloc(sizeof(Node));
+    live_nodes[j]->data = r;
+  }
+  double malloc_time = (double)(clock() - churn_start) / CLOCKS_PER_SEC;
+  for (int i = 0; i < live; i++)
+  {
+    free(live_nodes[i]);
+  }
+  free(live_nodes);
+  printf("노드 할당/반환 %d번: 노드 풀 %.3f초, malloc/free %.3f초\n", churn, pool_time, malloc_time);
   return 0;
 }
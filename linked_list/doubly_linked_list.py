@@ -25,6 +25,7 @@ class DoublyLinkedList:
         """
         리스트의 끝에 새 노드를 추가.
         :param data: 새 노드에 삽입할 데이터
+        :return: 추가된 노드 (insert_after/insert_before/remove_node에 사용할 핸들)
         """
         new_node = Node(data)
         if self.is_empty():
@@ -35,11 +36,13 @@ class DoublyLinkedList:
                 current = current.next
             current.next = new_node
             new_node.prev = current
+        return new_node
 
     def prepend(self, data):
         """
         리스트의 시작에 새 노드를 추가.
         :param data: 새 노드에 삽입할 데이터
+        :return: 추가된 노드 (핸들)
         """
         new_node = Node(data)
         if self.is_empty():
@@ -48,6 +51,47 @@ class DoublyLinkedList:
             new_node.next = self.head
             self.head.prev = new_node
             self.head = new_node
+        return new_node
+
+    def insert_after(self, node, data):
+        """
+        노드 핸들 바로 뒤에 새 노드를 삽입 (검색 없이 O(1)).
+        :param node: 기준 노드
+        :param data: 삽입할 데이터
+        :return: 삽입된 노드 (핸들)
+        """
+        new_node = Node(data)
+        new_node.prev = node
+        new_node.next = node.next
+        if node.next:
+            node.next.prev = new_node
+        node.next = new_node
+        return new_node
+
+    def insert_before(self, node, data):
+        """
+        노드 핸들 바로 앞에 새 노드를 삽입 (검색 없이 O(1)).
+        :param node: 기준 노드
+        :param data: 삽입할 데이터
+        :return: 삽입된 노드 (핸들)
+        """
+        if node.prev is None:
+            return self.prepend(data)
+        return self.insert_after(node.prev, data)
+
+    def remove_node(self, node):
+        """
+        노드 핸들이 가리키는 노드를 삭제 (검색 없이 O(1)).
+        :param node: 삭제할 노드
+        """
+        if node.prev:
+            node.prev.next = node.next
+        else:
+            self.head = node.next
+        if node.next:
+            node.next.prev = node.prev
+        node.prev = None
+        node.next = None
 
     def delete(self, data):
         """
@@ -85,6 +129,45 @@ class DoublyLinkedList:
             current = current.next
         return False
 
+    def search_batch(self, keys):
+        """
+        여러 키를 한 번의 순회로 검색 (search를 키마다 부르는 O(k·n) 대신 O(k + n)).
+        키 집합을 한 번 해시해 두고, 모든 키를 찾으면 순회를 멈춘다.
+        :param keys: 검색할 데이터 목록
+        :return: keys와 같은 순서로 각 키의 존재 여부(True/False)를 담은 리스트
+        """
+        pending = set(keys)
+        found = set()
+        current = self.head
+        while current and pending:
+            if current.data in pending:
+                pending.discard(current.data)
+                found.add(current.data)
+            current = current.next
+        return [key in found for key in keys]
+
+    def delete_batch(self, keys):
+        """
+        keys의 각 키마다 그 값을 가진 첫 번째 노드를 한 번의 순회로 삭제.
+        delete를 keys 순서대로 부른 것과 결과가 같다 (같은 키가 여러 번 있으면 그 수만큼 앞에서부터 삭제).
+        :param keys: 삭제할 데이터 목록
+        :return: 삭제한 노드 수
+        """
+        remaining = {}
+        for key in keys:
+            remaining[key] = remaining.get(key, 0) + 1
+
+        deleted = 0
+        current = self.head
+        while current and deleted < len(keys):
+            next_node = current.next  # remove_node가 연결을 끊기 전에 읽어 둠
+            if remaining.get(current.data, 0) > 0:
+                remaining[current.data] -= 1
+                deleted += 1
+                self.remove_node(current)
+            current = next_node
+        return deleted
+
     def show(self):
         """
         리스트의 내용을 출력.
@@ -209,7 +292,7 @@ if __name__ == "__main__":
     dll = DoublyLinkedList()
     dll.append(10)
     dll.append(20)
-    dll.append(30)
+    node30 = dll.append(30)  # append/prepend는 노드 핸들을 반환
     dll.show()
     dll.prepend(5)
     dll.show()
@@ -224,5 +307,13 @@ if __name__ == "__main__":
     dll.show()
     dll.delete_at(2)
     dll.show()
+    node7 = dll.insert_after(dll.head, 7)  # 핸들 기준 O(1) 삽입
+    dll.insert_before(node30, 25)
+    dll.show()
+    dll.remove_node(node7)  # 핸들로 O(1) 삭제
+    dll.show()
     print("중간 노드:", dll.find_middle())
     print("2번째 노드:", dll.get_nth(2))
+    print("한 번에 검색:", dll.search_batch([10, 40, 30]))
+    print("한 번에 삭제한 노드 수:", dll.delete_batch([10, 40, 30, 10]))
+    dll.show()
@@ -0,0 +1,629 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * 매크로로 생성하는 타입 지정(generic) 연결 리스트
+ *  - SLIST_DEFINE(name, T): 단일 연결 리스트
+ *  - DLIST_DEFINE(name, T): 이중 연결 리스트
+ *  - CLIST_DEFINE(name, T): 이중 원형 연결 리스트
+ *
+ * 데이터 T는 노드 안에 그대로(inline) 저장되므로, 작은 구조체도 별도의
+ * 포인터를 거치지 않고 노드에서 바로 읽을 수 있다.
+ * search/delete는 init에서 넘겨받은 비교 함수 equals로 데이터를 비교한다.
+ *
+ * 생성되는 이름 (name이 IntList일 때)
+ *  - 타입: IntList, IntList_Node
+ *  - 함수: IntList_init, IntList_is_empty, IntList_append, IntList_prepend,
+ *          IntList_delete, IntList_search, IntList_show, IntList_reverse,
+ *          IntList_length, IntList_find_middle, IntList_get_nth, IntList_free_list
+ *  - find_middle/get_nth는 데이터의 포인터를 반환 (없으면 NULL)
+ */
+
+/*
+ * 단일 연결 리스트 생성 매크로
+ */
+#define SLIST_DEFINE(name, T)                                                  \
+  typedef struct name##_Node                                                   \
+  {                                                                            \
+    T data;                                                                    \
+    struct name##_Node *next;                                                  \
+  } name##_Node;                                                               \
+                                                                               \
+  typedef struct name                                                          \
+  {                                                                            \
+    name##_Node *head;                                                         \
+    name##_Node *tail;                                                         \
+    int size;                                                                  \
+    int (*equals)(const T *a, const T *b);                                     \
+  } name;                                                                      \
+                                                                               \
+  static inline void name##_init(name *list, int (*equals)(const T *, const T *)) \
+  {                                                                            \
+    list->head = NULL;                                                         \
+    list->tail = NULL;                                                         \
+    list->size = 0;                                                            \
+    list->equals = equals;                                                     \
+  }                                                                            \
+                                                                               \
+  static inline int name##_is_empty(name *list)                                \
+  {                                                                            \
+    return list->head == NULL;                                                 \
+  }                                                                            \
+                                                                               \
+  static inline void name##_append(name *list, T data)                         \
+  {                                                                            \
+    name##_Node *new_node = (name##_Node *)malloc(sizeof(name##_Node));        \
+    new_node->data = data;                                                     \
+    new_node->next = NULL;                                                     \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      list->head = new_node;                                                   \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      list->tail->next = new_node;                                             \
+    }                                                                          \
+    list->tail = new_node;                                                     \
+    list->size++;                                                              \
+  }                                                                            \
+                                                                               \
+  static inline void name##_prepend(name *list, T data)                        \
+  {                                                                            \
+    name##_Node *new_node = (name##_Node *)malloc(sizeof(name##_Node));        \
+    new_node->data = data;                                                     \
+    new_node->next = list->head;                                               \
+    list->head = new_node;                                                     \
+    if (!list->tail)                                                           \
+    {                                                                          \
+      list->tail = new_node;                                                   \
+    }                                                                          \
+    list->size++;                                                              \
+  }                                                                            \
+                                                                               \
+  static inline int name##_delete(name *list, const T *data)                   \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    name##_Node *prev = NULL;                                                  \
+    while (current)                                                            \
+    {                                                                          \
+      if (list->equals(&current->data, data))                                  \
+      {                                                                        \
+        if (prev)                                                              \
+        {                                                                      \
+          prev->next = current->next;                                          \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+          list->head = current->next;                                          \
+        }                                                                      \
+        if (current == list->tail)                                             \
+        {                                                                      \
+          list->tail = prev;                                                   \
+        }                                                                      \
+        free(current);                                                         \
+        list->size--;                                                          \
+        return 1;                                                              \
+      }                                                                        \
+      prev = current;                                                          \
+      current = current->next;                                                 \
+    }                                                                          \
+    return 0;                                                                  \
+  }                                                                            \
+                                                                               \
+  static inline int name##_search(name *list, const T *data)                   \
+  {                                                                            \
+    for (name##_Node *current = list->head; current; current = current->next)  \
+    {                                                                          \
+      if (list->equals(&current->data, data))                                  \
+      {                                                                        \
+        return 1;                                                              \
+      }                                                                        \
+    }                                                                          \
+    return 0;                                                                  \
+  }                                                                            \
+                                                                               \
+  static inline void name##_show(name *list, void (*print)(const T *))         \
+  {                                                                            \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      printf("리스트가 비어 있습니다.\n");                                     \
+      return;                                                                  \
+    }                                                                          \
+    for (name##_Node *current = list->head; current; current = current->next)  \
+    {                                                                          \
+      print(&current->data);                                                   \
+      printf(" -> ");                                                          \
+    }                                                                          \
+    printf("NULL\n");                                                          \
+  }                                                                            \
+                                                                               \
+  static inline void name##_reverse(name *list)                                \
+  {                                                                            \
+    name##_Node *prev = NULL;                                                  \
+    name##_Node *current = list->head;                                         \
+    name##_Node *next = NULL;                                                  \
+    list->tail = list->head;                                                   \
+    while (current)                                                            \
+    {                                                                          \
+      next = current->next;                                                    \
+      current->next = prev;                                                    \
+      prev = current;                                                          \
+      current = next;                                                          \
+    }                                                                          \
+    list->head = prev;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline int name##_length(name *list)                                  \
+  {                                                                            \
+    return list->size;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline T *name##_find_middle(name *list)                              \
+  {                                                                            \
+    name##_Node *slow = list->head;                                            \
+    name##_Node *fast = list->head;                                            \
+    while (fast && fast->next)                                                 \
+    {                                                                          \
+      slow = slow->next;                                                       \
+      fast = fast->next->next;                                                 \
+    }                                                                          \
+    return slow ? &slow->data : NULL;                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *name##_get_nth(name *list, int n)                           \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    for (int count = 0; current; count++, current = current->next)             \
+    {                                                                          \
+      if (count == n)                                                          \
+      {                                                                        \
+        return &current->data;                                                 \
+      }                                                                        \
+    }                                                                          \
+    return NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  static inline void name##_free_list(name *list)                              \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    name##_Node *next;                                                         \
+    while (current)                                                            \
+    {                                                                          \
+      next = current->next;                                                    \
+      free(current);                                                           \
+      current = next;                                                          \
+    }                                                                          \
+    list->head = NULL;                                                         \
+    list->tail = NULL;                                                         \
+    list->size = 0;                                                            \
+  }
+
+/*
+ * 이중 연결 리스트 생성 매크로
+ */
+#define DLIST_DEFINE(name, T)                                                  \
+  typedef struct name##_Node                                                   \
+  {                                                                            \
+    T data;                                                                    \
+    struct name##_Node *next;                                                  \
+    struct name##_Node *prev;                                                  \
+  } name##_Node;                                                               \
+                                                                               \
+  typedef struct name                                                          \
+  {                                                                            \
+    name##_Node *head;                                                         \
+    name##_Node *tail;                                                         \
+    int size;                                                                  \
+    int (*equals)(const T *a, const T *b);                                     \
+  } name;                                                                      \
+                                                                               \
+  static inline void name##_init(name *list, int (*equals)(const T *, const T *)) \
+  {                                                                            \
+    list->head = NULL;                                                         \
+    list->tail = NULL;                                                         \
+    list->size = 0;                                                            \
+    list->equals = equals;                                                     \
+  }                                                                            \
+                                                                               \
+  static inline int name##_is_empty(name *list)                                \
+  {                                                                            \
+    return list->head == NULL;                                                 \
+  }                                                                            \
+                                                                               \
+  static inline void name##_append(name *list, T data)                         \
+  {                                                                            \
+    name##_Node *new_node = (name##_Node *)malloc(sizeof(name##_Node));        \
+    new_node->data = data;                                                     \
+    new_node->next = NULL;                                                     \
+    new_node->prev = list->tail;                                               \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      list->head = new_node;                                                   \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      list->tail->next = new_node;                                             \
+    }                                                                          \
+    list->tail = new_node;                                                     \
+    list->size++;                                                              \
+  }                                                                            \
+                                                                               \
+  static inline void name##_prepend(name *list, T data)                        \
+  {                                                                            \
+    name##_Node *new_node = (name##_Node *)malloc(sizeof(name##_Node));        \
+    new_node->data = data;                                                     \
+    new_node->next = list->head;                                               \
+    new_node->prev = NULL;                                                     \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      list->tail = new_node;                                                   \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      list->head->prev = new_node;                                             \
+    }                                                                          \
+    list->head = new_node;                                                     \
+    list->size++;                                                              \
+  }                                                                            \
+                                                                               \
+  static inline int name##_delete(name *list, const T *data)                   \
+  {                                                                            \
+    for (name##_Node *current = list->head; current; current = current->next)  \
+    {                                                                          \
+      if (list->equals(&current->data, data))                                  \
+      {                                                                        \
+        if (current->prev)                                                     \
+        {                                                                      \
+          current->prev->next = current->next;                                 \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+          list->head = current->next;                                          \
+        }                                                                      \
+        if (current->next)                                                     \
+        {                                                                      \
+          current->next->prev = current->prev;                                 \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+          list->tail = current->prev;                                          \
+        }                                                                      \
+        free(current);                                                         \
+        list->size--;                                                          \
+        return 1;                                                              \
+      }                                                                        \
+    }                                                                          \
+    return 0;                                                                  \
+  }                                                                            \
+                                                                               \
+  static inline int name##_search(name *list, const T *data)                   \
+  {                                                                            \
+    for (name##_Node *current = list->head; current; current = current->next)  \
+    {                                                                          \
+      if (list->equals(&current->data, data))                                  \
+      {                                                                        \
+        return 1;                                                              \
+      }                                                                        \
+    }                                                                          \
+    return 0;                                                                  \
+  }                                                                            \
+                                                                               \
+  static inline void name##_show(name *list, void (*print)(const T *))         \
+  {                                                                            \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      printf("리스트가 비어 있습니다.\n");                                     \
+      return;                                                                  \
+    }                                                                          \
+    for (name##_Node *current = list->head; current; current = current->next)  \
+    {                                                                          \
+      print(&current->data);                                                   \
+      printf(" <-> ");                                                         \
+    }                                                                          \
+    printf("NULL\n");                                                          \
+  }                                                                            \
+                                                                               \
+  static inline void name##_reverse(name *list)                                \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    name##_Node *temp;                                                         \
+    list->head = list->tail;                                                   \
+    list->tail = current;                                                      \
+    while (current)                                                            \
+    {                                                                          \
+      temp = current->prev;                                                    \
+      current->prev = current->next;                                           \
+      current->next = temp;                                                    \
+      current = current->prev;                                                 \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static inline int name##_length(name *list)                                  \
+  {                                                                            \
+    return list->size;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline T *name##_find_middle(name *list)                              \
+  {                                                                            \
+    name##_Node *slow = list->head;                                            \
+    name##_Node *fast = list->head;                                            \
+    while (fast && fast->next)                                                 \
+    {                                                                          \
+      slow = slow->next;                                                       \
+      fast = fast->next->next;                                                 \
+    }                                                                          \
+    return slow ? &slow->data : NULL;                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *name##_get_nth(name *list, int n)                           \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    for (int count = 0; current; count++, current = current->next)             \
+    {                                                                          \
+      if (count == n)                                                          \
+      {                                                                        \
+        return &current->data;                                                 \
+      }                                                                        \
+    }                                                                          \
+    return NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  static inline void name##_free_list(name *list)                              \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    name##_Node *next;                                                         \
+    while (current)                                                            \
+    {                                                                          \
+      next = current->next;                                                    \
+      free(current);                                                           \
+      current = next;                                                          \
+    }                                                                          \
+    list->head = NULL;                                                         \
+    list->tail = NULL;                                                         \
+    list->size = 0;                                                            \
+  }
+
+/*
+ * 이중 원형 연결 리스트 생성 매크로
+ *  - tail은 항상 head->prev
+ */
+#define CLIST_DEFINE(name, T)                                                  \
+  typedef struct name##_Node                                                   \
+  {                                                                            \
+    T data;                                                                    \
+    struct name##_Node *next;                                                  \
+    struct name##_Node *prev;                                                  \
+  } name##_Node;                                                               \
+                                                                               \
+  typedef struct name                                                          \
+  {                                                                            \
+    name##_Node *head;                                                         \
+    int size;                                                                  \
+    int (*equals)(const T *a, const T *b);                                     \
+  } name;                                                                      \
+                                                                               \
+  static inline void name##_init(name *list, int (*equals)(const T *, const T *)) \
+  {                                                                            \
+    list->head = NULL;                                                         \
+    list->size = 0;                                                            \
+    list->equals = equals;                                                     \
+  }                                                                            \
+                                                                               \
+  static inline int name##_is_empty(name *list)                                \
+  {                                                                            \
+    return list->head == NULL;                                                 \
+  }                                                                            \
+                                                                               \
+  static inline void name##_append(name *list, T data)                         \
+  {                                                                            \
+    name##_Node *new_node = (name##_Node *)malloc(sizeof(name##_Node));        \
+    new_node->data = data;                                                     \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      new_node->next = new_node;                                               \
+      new_node->prev = new_node;                                               \
+      list->head = new_node;                                                   \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      name##_Node *tail = list->head->prev;                                    \
+      new_node->next = list->head;                                             \
+      new_node->prev = tail;                                                   \
+      tail->next = new_node;                                                   \
+      list->head->prev = new_node;                                             \
+    }                                                                          \
+    list->size++;                                                              \
+  }                                                                            \
+                                                                               \
+  static inline void name##_prepend(name *list, T data)                        \
+  {                                                                            \
+    name##_append(list, data);                                                 \
+    list->head = list->head->prev;                                             \
+  }                                                                            \
+                                                                               \
+  static inline int name##_delete(name *list, const T *data)                   \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    for (int i = 0; i < list->size; i++, current = current->next)              \
+    {                                                                          \
+      if (list->equals(&current->data, data))                                  \
+      {                                                                        \
+        if (list->size == 1)                                                   \
+        {                                                                      \
+          list->head = NULL;                                                   \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+          current->prev->next = current->next;                                 \
+          current->next->prev = current->prev;                                 \
+          if (current == list->head)                                           \
+          {                                                                    \
+            list->head = current->next;                                        \
+          }                                                                    \
+        }                                                                      \
+        free(current);                                                         \
+        list->size--;                                                          \
+        return 1;                                                              \
+      }                                                                        \
+    }                                                                          \
+    return 0;                                                                  \
+  }                                                                            \
+                                                                               \
+  static inline int name##_search(name *list, const T *data)                   \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    for (int i = 0; i < list->size; i++, current = current->next)              \
+    {                                                                          \
+      if (list->equals(&current->data, data))                                  \
+      {                                                                        \
+        return 1;                                                              \
+      }                                                                        \
+    }                                                                          \
+    return 0;                                                                  \
+  }                                                                            \
+                                                                               \
+  static inline void name##_show(name *list, void (*print)(const T *))         \
+  {                                                                            \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      printf("리스트가 비어 있습니다.\n");                                     \
+      return;                                                                  \
+    }                                                                          \
+    name##_Node *current = list->head;                                         \
+    for (int i = 0; i < list->size; i++, current = current->next)              \
+    {                                                                          \
+      print(&current->data);                                                   \
+      printf(" <-> ");                                                         \
+    }                                                                          \
+    printf("(다시 head)\n");                                                   \
+  }                                                                            \
+                                                                               \
+  static inline void name##_reverse(name *list)                                \
+  {                                                                            \
+    if (name##_is_empty(list))                                                 \
+    {                                                                          \
+      return;                                                                  \
+    }                                                                          \
+    name##_Node *current = list->head;                                         \
+    name##_Node *temp;                                                         \
+    for (int i = 0; i < list->size; i++)                                       \
+    {                                                                          \
+      temp = current->prev;                                                    \
+      current->prev = current->next;                                           \
+      current->next = temp;                                                    \
+      current = current->prev;                                                 \
+    }                                                                          \
+    list->head = list->head->next;                                             \
+  }                                                                            \
+                                                                               \
+  static inline int name##_length(name *list)                                  \
+  {                                                                            \
+    return list->size;                                                         \
+  }                                                                            \
+                                                                               \
+  static inline T *name##_get_nth(name *list, int n)                           \
+  {                                                                            \
+    if (n < 0 || n >= list->size)                                              \
+    {                                                                          \
+      return NULL;                                                             \
+    }                                                                          \
+    name##_Node *current = list->head;                                         \
+    for (int i = 0; i < n; i++)                                                \
+    {                                                                          \
+      current = current->next;                                                 \
+    }                                                                          \
+    return &current->data;                                                     \
+  }                                                                            \
+                                                                               \
+  static inline T *name##_find_middle(name *list)                              \
+  {                                                                            \
+    return name##_get_nth(list, (list->size - 1) / 2);                         \
+  }                                                                            \
+                                                                               \
+  static inline void name##_free_list(name *list)                              \
+  {                                                                            \
+    name##_Node *current = list->head;                                         \
+    name##_Node *next;                                                         \
+    for (int i = 0; i < list->size; i++)                                       \
+    {                                                                          \
+      next = current->next;                                                    \
+      free(current);                                                           \
+      current = next;                                                          \
+    }                                                                          \
+    list->head = NULL;                                                         \
+    list->size = 0;                                                            \
+  }
+
+// 사용 예제에서 쓸 작은 구조체 (노드 안에 그대로 저장됨)
+typedef struct Point
+{
+  int x;
+  int y;
+} Point;
+
+int point_equals(const Point *a, const Point *b)
+{
+  return a->x == b->x && a->y == b->y;
+}
+
+void point_print(const Point *p)
+{
+  printf("(%d, %d)", p->x, p->y);
+}
+
+int int_equals(const int *a, const int *b)
+{
+  return *a == *b;
+}
+
+void int_print(const int *v)
+{
+  printf("%d", *v);
+}
+
+SLIST_DEFINE(PointList, Point)
+DLIST_DEFINE(IntList, int)
+CLIST_DEFINE(IntRing, int)
+
+// 사용 예제
+int main()
+{
+  // 단일 연결 리스트: Point를 노드 안에 저장
+  PointList points;
+  PointList_init(&points, point_equals);
+  PointList_append(&points, (Point){1, 2});
+  PointList_append(&points, (Point){3, 4});
+  PointList_prepend(&points, (Point){0, 0});
+  PointList_show(&points, point_print);
+  Point target = {3, 4};
+  printf("(3, 4) 검색: %d\n", PointList_search(&points, &target));
+  PointList_delete(&points, &target);
+  PointList_show(&points, point_print);
+  PointList_free_list(&points);
+
+  // 이중 연결 리스트
+  IntList dll;
+  IntList_init(&dll, int_equals);
+  IntList_append(&dll, 10);
+  IntList_append(&dll, 20);
+  IntList_append(&dll, 30);
+  IntList_prepend(&dll, 5);
+  IntList_reverse(&dll);
+  IntList_show(&dll, int_print);
+  printf("중간 노드: %d\n", *IntList_find_middle(&dll));
+  IntList_free_list(&dll);
+
+  // 이중 원형 연결 리스트
+  IntRing ring;
+  IntRing_init(&ring, int_equals);
+  IntRing_append(&ring, 10);
+  IntRing_append(&ring, 20);
+  IntRing_append(&ring, 30);
+  IntRing_prepend(&ring, 5);
+  int twenty = 20;
+  IntRing_delete(&ring, &twenty);
+  IntRing_show(&ring, int_print);
+  printf("2번째 노드: %d\n", *IntRing_get_nth(&ring, 2));
+  IntRing_free_list(&ring);
+  return 0;
+}
@@ -0,0 +1,756 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// 노드를 가리키는 32비트 번호 (노드 배열 안의 위치)
+// 64비트 포인터 대신 번호로 연결해 링크 크기를 절반으로 줄인다. 노드 수는 NIL 미만(약 40억 개)으로 제한된다.
+typedef uint32_t NodeIndex;
+
+// 노드가 없음을 나타내는 번호 (포인터 버전의 NULL)
+#define NIL UINT32_MAX
+
+// 번호로 연결하는 이중 연결 리스트의 노드를 나타내는 구조체 (12바이트, 포인터 버전은 24바이트)
+typedef struct Node
+{
+  int data;       // 노드에 저장된 데이터
+  NodeIndex next; // 다음 노드의 번호
+  NodeIndex prev; // 이전 노드의 번호
+} Node;
+
+// 처음 할당하는 노드 배열의 크기
+#define INITIAL_CAPACITY 256
+
+// 노드 풀: 크기가 늘어나는 노드 배열과 반환된 노드를 재사용하기 위한 free list
+// 배열을 realloc으로 늘려 주소가 바뀌어도 번호는 그대로이므로 링크와 노드 핸들을 고칠 필요가 없다.
+typedef struct NodePool
+{
+  Node *nodes;          // 노드 배열
+  NodeIndex capacity;   // 배열 크기
+  NodeIndex used;       // 한 번이라도 쓰인 칸 수 (새 노드는 이 뒤에서 할당)
+  NodeIndex free_nodes; // 재사용 가능한 노드 목록 (next로 연결된 침습형 free list)
+} NodePool;
+
+// 이중 연결 리스트를 나타내는 구조체
+typedef struct DoublyLinkedList
+{
+  NodeIndex head;   // 리스트의 시작(head)
+  NodeIndex tail;   // 리스트의 끝(tail), append를 O(1)로 만들기 위해 유지
+  int size;         // 노드 수, length를 O(1)로 만들기 위해 유지
+  NodePool pool;    // 노드를 할당하는 리스트 전용 노드 풀
+  NodeIndex cursor; // 마지막으로 get_nth로 접근한 노드 (NIL이면 없음)
+  int cursor_index; // cursor의 위치
+} DoublyLinkedList;
+
+// 리스트를 처음부터 끝까지 O(n)에 순회하기 위한 반복자
+typedef struct ListIter
+{
+  const Node *nodes; // 리스트의 노드 배열 (순회 중 리스트를 수정하면 안 됨)
+  NodeIndex node;    // 현재 노드 (끝이면 NIL)
+  int index;         // 현재 위치
+} ListIter;
+
+// 노드 풀 초기화 함수
+void pool_init(NodePool *pool)
+{
+  pool->nodes = NULL;
+  pool->capacity = 0;
+  pool->used = 0;
+  pool->free_nodes = NIL;
+}
+
+// 배열에 빈 칸을 n개 이상 확보하는 함수
+// 두 배로 늘리되, 한 번에 그보다 많이 필요하면(list_append_array) 필요한 만큼만 늘린다.
+void pool_reserve(NodePool *pool, size_t n)
+{
+  size_t needed = (size_t)pool->used + n;
+  if (needed <= pool->capacity)
+  {
+    return;
+  }
+  if (needed >= NIL)
+  {
+    printf("노드 수가 32비트 번호 범위를 넘었습니다.\n");
+    abort();
+  }
+
+  size_t capacity = pool->capacity ? (size_t)pool->capacity * 2 : INITIAL_CAPACITY;
+  if (capacity < needed)
+  {
+    capacity = needed;
+  }
+  if (capacity >= NIL)
+  {
+    capacity = NIL - 1;
+  }
+  pool->nodes = (Node *)realloc(pool->nodes, capacity * sizeof(Node));
+  pool->capacity = (NodeIndex)capacity;
+}
+
+// 풀에서 노드 하나를 꺼내 번호를 반환하는 함수 (free list가 비면 배열 끝에서 할당)
+NodeIndex pool_alloc(NodePool *pool)
+{
+  if (pool->free_nodes != NIL)
+  {
+    NodeIndex node = pool->free_nodes;
+    pool->free_nodes = pool->nodes[node].next;
+    return node;
+  }
+  pool_reserve(pool, 1);
+  return pool->used++;
+}
+
+// 노드를 풀의 free list로 반환하는 함수
+void pool_free(NodePool *pool, NodeIndex node)
+{
+  pool->nodes[node].next = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+// 연속된 노드 n개를 배열 끝에서 할당해 첫 번호를 반환하는 함수 (free list를 거치지 않음)
+NodeIndex pool_alloc_block(NodePool *pool, size_t n)
+{
+  pool_reserve(pool, n);
+  NodeIndex first = pool->used;
+  pool->used += (NodeIndex)n;
+  return first;
+}
+
+// 노드 배열을 해제하는 함수 (free 한 번)
+void pool_destroy(NodePool *pool)
+{
+  free(pool->nodes);
+  pool_init(pool);
+}
+
+// 리스트 초기화 함수
+void init(DoublyLinkedList *list)
+{
+  list->head = NIL;
+  list->tail = NIL;
+  list->size = 0;
+  pool_init(&list->pool);
+  list->cursor = NIL;
+  list->cursor_index = 0;
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(DoublyLinkedList *list)
+{
+  return list->head == NIL;
+}
+
+// 리스트의 끝에 새 노드를 추가하는 함수 (추가된 노드의 번호를 핸들로 반환)
+// 번호는 배열이 늘어나도 바뀌지 않으므로, 포인터 버전과 달리 핸들을 계속 쓸 수 있다.
+NodeIndex append(DoublyLinkedList *list, int data)
+{
+  NodeIndex new_node = pool_alloc(&list->pool);
+  Node *nodes = list->pool.nodes; // pool_alloc이 배열을 옮겼을 수 있으므로 할당 후에 읽음
+  nodes[new_node].data = data;
+  nodes[new_node].next = NIL;
+  nodes[new_node].prev = list->tail;
+
+  if (is_empty(list))
+  {
+    list->head = new_node;
+  }
+  else
+  {
+    nodes[list->tail].next = new_node; // tail을 유지하므로 끝까지 순회할 필요 없음
+  }
+  list->tail = new_node;
+  list->size++;
+  return new_node;
+}
+
+// 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수
+// n개의 노드를 노드 배열의 연속된 칸에 순회 순서대로 놓으므로, 이후 순회는 메모리를 순서대로 읽는다.
+void list_append_array(DoublyLinkedList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+
+  NodeIndex first = pool_alloc_block(&list->pool, n);
+  Node *nodes = list->pool.nodes;
+  for (size_t i = 0; i < n; i++)
+  {
+    nodes[first + i].data = vals[i];
+    nodes[first + i].next = first + (NodeIndex)i + 1;
+    nodes[first + i].prev = first + (NodeIndex)i - 1;
+  }
+  NodeIndex last = first + (NodeIndex)n - 1;
+  nodes[last].next = NIL;
+  nodes[first].prev = list->tail;
+
+  if (is_empty(list))
+  {
+    list->head = first;
+  }
+  else
+  {
+    nodes[list->tail].next = first;
+  }
+  list->tail = last;
+  list->size += (int)n;
+}
+
+// 배열로 새 리스트를 만드는 함수 (append를 n번 호출하는 대신 할당 한 번)
+DoublyLinkedList list_from_array(const int *vals, size_t n)
+{
+  DoublyLinkedList list;
+  init(&list);
+  list_append_array(&list, vals, n);
+  return list;
+}
+
+// 리스트의 시작에 새 노드를 추가하는 함수 (추가된 노드의 번호를 핸들로 반환)
+NodeIndex prepend(DoublyLinkedList *list, int data)
+{
+  NodeIndex new_node = pool_alloc(&list->pool);
+  Node *nodes = list->pool.nodes;
+  nodes[new_node].data = data;
+  nodes[new_node].next = list->head;
+  nodes[new_node].prev = NIL;
+
+  if (!is_empty(list))
+  {
+    nodes[list->head].prev = new_node;
+  }
+  else
+  {
+    list->tail = new_node;
+  }
+
+  list->head = new_node;
+  list->size++;
+  list->cursor_index++; // 모든 노드의 위치가 한 칸씩 밀림
+  return new_node;
+}
+
+// 노드 핸들 바로 뒤에 새 노드를 삽입하는 함수 (검색 없이 O(1))
+NodeIndex insert_after(DoublyLinkedList *list, NodeIndex node, int data)
+{
+  if (node == list->tail)
+  {
+    return append(list, data);
+  }
+
+  NodeIndex new_node = pool_alloc(&list->pool);
+  Node *nodes = list->pool.nodes;
+  NodeIndex next = nodes[node].next;
+  nodes[new_node].data = data;
+  nodes[new_node].prev = node;
+  nodes[new_node].next = next;
+  nodes[next].prev = new_node;
+  nodes[node].next = new_node;
+  list->size++;
+  list->cursor = NIL; // 위치가 바뀔 수 있으므로 cursor를 버림
+  return new_node;
+}
+
+// 노드 핸들 바로 앞에 새 노드를 삽입하는 함수 (검색 없이 O(1))
+NodeIndex insert_before(DoublyLinkedList *list, NodeIndex node, int data)
+{
+  if (node == list->head)
+  {
+    return prepend(list, data);
+  }
+  return insert_after(list, list->pool.nodes[node].prev, data);
+}
+
+// 노드 핸들이 가리키는 노드를 삭제하는 함수 (검색 없이 O(1))
+void remove_node(DoublyLinkedList *list, NodeIndex node)
+{
+  Node *nodes = list->pool.nodes;
+  NodeIndex next = nodes[node].next;
+  NodeIndex prev = nodes[node].prev;
+  if (prev != NIL)
+  {
+    nodes[prev].next = next;
+  }
+  else
+  {
+    list->head = next;
+  }
+
+  if (next != NIL)
+  {
+    nodes[next].prev = prev;
+  }
+  else
+  {
+    list->tail = prev;
+  }
+  pool_free(&list->pool, node);
+  list->size--;
+  list->cursor = NIL; // 위치가 바뀔 수 있으므로 cursor를 버림
+}
+
+// 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
+void delete(DoublyLinkedList *list, int data)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다. 삭제할 수 없습니다.\n");
+    return;
+  }
+
+  const Node *nodes = list->pool.nodes;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    if (nodes[current].data == data)
+    {
+      remove_node(list, current);
+      return;
+    }
+  }
+  printf("리스트에 해당 데이터가 없습니다.\n");
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수
+int search(DoublyLinkedList *list, int data)
+{
+  const Node *nodes = list->pool.nodes;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    if (nodes[current].data == data)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// 리스트의 내용을 출력하는 함수
+void show(DoublyLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  const Node *nodes = list->pool.nodes;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    printf("%d <-> ", nodes[current].data);
+  }
+  printf("NULL\n");
+}
+
+// 리스트를 뒤집는 함수 (각 노드의 next와 prev를 맞바꿈)
+void reverse(DoublyLinkedList *list)
+{
+  Node *nodes = list->pool.nodes;
+  NodeIndex current = list->head;
+  while (current != NIL)
+  {
+    NodeIndex next = nodes[current].next;
+    nodes[current].next = nodes[current].prev;
+    nodes[current].prev = next;
+    current = next;
+  }
+
+  NodeIndex temp = list->head;
+  list->head = list->tail;
+  list->tail = temp;
+  list->cursor_index = list->size - 1 - list->cursor_index; // cursor 노드의 위치가 뒤집힘
+}
+
+// 리스트의 노드 수를 계산하는 함수
+int length(DoublyLinkedList *list)
+{
+  return list->size;
+}
+
+// 리스트의 중간 노드를 찾는 함수
+int find_middle(DoublyLinkedList *list)
+{
+  const Node *nodes = list->pool.nodes;
+  NodeIndex slow = list->head;
+  NodeIndex fast = list->head;
+
+  while (fast != NIL && nodes[fast].next != NIL)
+  {
+    slow = nodes[slow].next;
+    fast = nodes[nodes[fast].next].next;
+  }
+  return slow != NIL ? nodes[slow].data : -1;
+}
+
+// 리스트에서 N번째 노드 데이터를 찾는 함수
+// head, tail, 마지막으로 접근한 위치(cursor) 중 가장 가까운 곳에서 앞/뒤로 이동
+// (i = 0..n-1 순서로 호출해도 전체 O(n))
+int get_nth(DoublyLinkedList *list, int n)
+{
+  if (n < 0 || n >= list->size)
+  {
+    printf("인덱스가 범위를 벗어났습니다.\n");
+    return -1;
+  }
+
+  const Node *nodes = list->pool.nodes;
+  NodeIndex current = list->head;
+  int count = 0;
+  int distance = n;
+  if (list->size - 1 - n < distance)
+  {
+    current = list->tail;
+    count = list->size - 1;
+    distance = list->size - 1 - n;
+  }
+  if (list->cursor != NIL && abs(n - list->cursor_index) < distance)
+  {
+    current = list->cursor;
+    count = list->cursor_index;
+  }
+  while (count < n)
+  {
+    current = nodes[current].next;
+    count++;
+  }
+  while (count > n)
+  {
+    current = nodes[current].prev;
+    count--;
+  }
+
+  list->cursor = current;
+  list->cursor_index = n;
+  return nodes[current].data;
+}
+
+// 메모리 해제 함수 (노드 배열을 통째로 해제)
+void free_list(DoublyLinkedList *list)
+{
+  pool_destroy(&list->pool);
+  list->head = NIL;
+  list->tail = NIL;
+  list->size = 0;
+  list->cursor = NIL;
+}
+
+// 반복자를 첫 노드에 두는 함수
+ListIter list_iter_begin(DoublyLinkedList *list)
+{
+  ListIter it = {list->pool.nodes, list->head, 0};
+  return it;
+}
+
+// 반복자가 끝에 도달했는지 확인하는 함수
+int list_iter_end(ListIter *it)
+{
+  return it->node == NIL;
+}
+
+// 반복자가 가리키는 노드의 데이터를 반환하는 함수
+int list_iter_data(ListIter *it)
+{
+  return it->nodes[it->node].data;
+}
+
+// 반복자를 다음 노드로 옮기는 함수
+void list_iter_next(ListIter *it)
+{
+  it->node = it->nodes[it->node].next;
+  it->index++;
+}
+
+// 리스트의 데이터를 앞에서부터 최대 max개까지 out 배열에 복사하는 함수 (부분 스냅샷)
+// 실제로 복사한 개수를 반환한다.
+int list_to_array_bounded(DoublyLinkedList *list, int *out, int max)
+{
+  const Node *nodes = list->pool.nodes;
+  int count = list->size < max ? list->size : max;
+  NodeIndex current = list->head;
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = nodes[current].data;
+    current = nodes[current].next;
+  }
+  return count;
+}
+
+// 리스트의 모든 데이터를 out 배열에 순서대로 복사하는 함수 (out은 length(list)개 이상)
+int list_to_array(DoublyLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+// 직렬화 형식을 확인하는 값과 형식 버전 (포인터 버전과 같은 형식이라 서로 읽고 쓸 수 있음)
+#define LIST_MAGIC "DSAL"
+#define LIST_FORMAT_VERSION 1
+// list_read가 한 번에 모아 list_append_array로 붙이는 데이터 수
+#define LIST_READ_CHUNK 4096
+
+// 부호 있는 차이를 작은 양수로 바꾸는 함수 (zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+uint64_t zigzag_encode(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t zigzag_decode(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// 7비트씩 나눠 기록하는 가변 길이 정수(varint)를 쓰는 함수 (작은 값일수록 짧음)
+void write_varint(FILE *fp, uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    putc((int)(v & 0x7F) | 0x80, fp);
+    v >>= 7;
+  }
+  putc((int)v, fp);
+}
+
+// varint를 읽는 함수 (성공하면 0, 파일이 끝났거나 형식이 틀리면 -1)
+int read_varint(FILE *fp, uint64_t *out)
+{
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    int c = getc(fp);
+    if (c == EOF)
+    {
+      return -1;
+    }
+    v |= (uint64_t)(c & 0x7F) << shift;
+    if (!(c & 0x80))
+    {
+      *out = v;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// 리스트를 이진 형식으로 기록하는 함수 (성공하면 0)
+// 형식: "DSAL" | 버전(1바이트) | 노드 수(varint) | 앞 데이터와의 차이(zigzag varint) x 노드 수
+int list_write(DoublyLinkedList *list, FILE *fp)
+{
+  fwrite(LIST_MAGIC, 1, 4, fp);
+  putc(LIST_FORMAT_VERSION, fp);
+  write_varint(fp, (uint64_t)list->size);
+
+  const Node *nodes = list->pool.nodes;
+  int64_t prev = 0;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    write_varint(fp, zigzag_encode((int64_t)nodes[current].data - prev));
+    prev = nodes[current].data;
+  }
+  return ferror(fp) ? -1 : 0;
+}
+
+// list_write로 기록한 리스트를 읽어 list의 끝에 추가하는 함수 (성공하면 0)
+// LIST_READ_CHUNK개씩 모아 list_append_array로 붙이므로 파일 전체를 메모리에 올리지 않는다.
+int list_read(DoublyLinkedList *list, FILE *fp)
+{
+  char magic[4];
+  uint64_t count;
+  if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LIST_MAGIC, 4) != 0 ||
+      getc(fp) != LIST_FORMAT_VERSION || read_varint(fp, &count) != 0)
+  {
+    printf("리스트 파일 형식이 맞지 않습니다.\n");
+    return -1;
+  }
+
+  int buffer[LIST_READ_CHUNK];
+  int filled = 0;
+  int64_t prev = 0;
+  for (uint64_t i = 0; i < count; i++)
+  {
+    uint64_t v;
+    if (read_varint(fp, &v) != 0)
+    {
+      list_append_array(list, buffer, filled); // 읽은 데까지는 붙여 둠
+      printf("리스트 파일이 중간에 끝났습니다.\n");
+      return -1;
+    }
+    prev += zigzag_decode(v);
+    buffer[filled++] = (int)prev;
+    if (filled == LIST_READ_CHUNK)
+    {
+      list_append_array(list, buffer, filled);
+      filled = 0;
+    }
+  }
+  list_append_array(list, buffer, filled);
+  return 0;
+}
+
+// 노드들이 배열에 얼마나 흩어져 있는지 구하는 함수 (0.0 ~ 1.0)
+// 순회 중 다음 노드가 배열상 바로 옆 칸이 아닌 경우의 비율. list_compact 직후에는 0이다.
+double fragmentation(DoublyLinkedList *list)
+{
+  if (list->size < 2)
+  {
+    return 0.0;
+  }
+
+  const Node *nodes = list->pool.nodes;
+  int scattered = 0;
+  for (NodeIndex current = list->head; nodes[current].next != NIL; current = nodes[current].next)
+  {
+    if (nodes[current].next != current + 1)
+    {
+      scattered++;
+    }
+  }
+  return (double)scattered / (list->size - 1);
+}
+
+// 모든 노드를 새 배열에 순회 순서대로 다시 배치하는 함수 (조각 모음)
+// 노드 번호가 0부터 순서대로 다시 매겨지므로, append/insert_after 등이 반환한 노드 핸들은 더 이상 쓸 수 없다.
+void list_compact(DoublyLinkedList *list)
+{
+  NodePool fresh;
+  pool_init(&fresh);
+  if (list->size > 0)
+  {
+    NodeIndex n = (NodeIndex)list->size;
+    pool_alloc_block(&fresh, n); // 새 배열은 비어 있으므로 0번부터 할당됨
+    const Node *old = list->pool.nodes;
+    Node *nodes = fresh.nodes;
+    NodeIndex current = list->head;
+    for (NodeIndex i = 0; i < n; i++)
+    {
+      nodes[i].data = old[current].data;
+      nodes[i].next = (i + 1 < n) ? i + 1 : NIL;
+      nodes[i].prev = (i > 0) ? i - 1 : NIL;
+      current = old[current].next;
+    }
+    list->head = 0;
+    list->tail = n - 1;
+    if (list->cursor != NIL)
+    {
+      list->cursor = (NodeIndex)list->cursor_index; // 위치는 그대로이므로 새 번호로 옮김
+    }
+  }
+  pool_destroy(&list->pool);
+  list->pool = fresh;
+}
+
+// 조각화 정도가 threshold 이상이면 list_compact를 수행하는 함수 (수행했으면 1)
+// 조각화 측정이 O(n)이므로 연산마다가 아니라 주기적으로(예: 유휴 시간, 일정 횟수의 삭제 후) 호출한다.
+int list_compact_if_fragmented(DoublyLinkedList *list, double threshold)
+{
+  if (fragmentation(list) < threshold)
+  {
+    return 0;
+  }
+  list_compact(list);
+  return 1;
+}
+
+// 비교용: 포인터 두 개로 연결하는 기존 이중 연결 리스트의 노드
+typedef struct PointerNode
+{
+  int data;
+  struct PointerNode *next;
+  struct PointerNode *prev;
+} PointerNode;
+
+// 사용 예제
+int main()
+{
+  DoublyLinkedList dll;
+  init(&dll);
+  append(&dll, 10);
+  append(&dll, 20);
+  NodeIndex node30 = append(&dll, 30); // append/prepend는 노드 번호를 핸들로 반환
+  show(&dll);
+  prepend(&dll, 5);
+  show(&dll);
+  delete (&dll, 20);
+  show(&dll);
+  NodeIndex node7 = insert_after(&dll, dll.head, 7); // 핸들 기준 O(1) 삽입
+  insert_before(&dll, node30, 25);
+  show(&dll);
+  remove_node(&dll, node7); // 핸들로 검색 없이 O(1) 삭제
+  show(&dll);
+  printf("10 검색: %d\n", search(&dll, 10));
+  printf("40 검색: %d\n", search(&dll, 40));
+  printf("리스트 길이: %d\n", length(&dll));
+  reverse(&dll);
+  show(&dll);
+  printf("중간 노드: %d\n", find_middle(&dll));
+  printf("2번째 노드: %d\n", get_nth(&dll, 2));
+  // 반복자로 전체를 O(n)에 순회
+  for (ListIter it = list_iter_begin(&dll); !list_iter_end(&it); list_iter_next(&it))
+  {
+    printf("[%d]=%d ", it.index, list_iter_data(&it));
+  }
+  printf("\n");
+  free_list(&dll);
+  // 배열에서 한 번에 리스트 만들기 (노드가 배열의 연속된 칸에 놓임)
+  int small[] = {1, 2, 3, 4, 5};
+  DoublyLinkedList bulk = list_from_array(small, 5);
+  list_append_array(&bulk, small, 2);
+  show(&bulk);
+  // 배열로 복사 (전체와 앞쪽 2개만)
+  int snapshot[8] = {0};
+  int copied = list_to_array(&bulk, snapshot);
+  printf("배열로 복사한 개수: %d, 마지막 값: %d\n", copied, snapshot[copied - 1]);
+  copied = list_to_array_bounded(&bulk, snapshot, 2);
+  printf("부분 스냅샷: %d개 [%d, %d]\n", copied, snapshot[0], snapshot[1]);
+  // 이진 형식으로 저장했다가 다시 읽기
+  FILE *fp = tmpfile();
+  list_write(&bulk, fp);
+  rewind(fp);
+  DoublyLinkedList loaded;
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  show(&loaded);
+  free_list(&loaded);
+  free_list(&bulk);
+
+  // 데이터당 메모리와 순회 속도를 포인터 버전과 비교 (두 리스트 모두 노드를 순서대로 연속 배치)
+  int n = 10000000;
+  int *values = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    values[i] = i;
+  }
+  DoublyLinkedList big = list_from_array(values, n);
+  PointerNode *pointer_nodes = (PointerNode *)malloc(n * sizeof(PointerNode));
+  for (int i = 0; i < n; i++)
+  {
+    pointer_nodes[i].data = values[i];
+    pointer_nodes[i].next = (i + 1 < n) ? &pointer_nodes[i + 1] : NULL;
+    pointer_nodes[i].prev = (i > 0) ? &pointer_nodes[i - 1] : NULL;
+  }
+  free(values);
+
+  int scans = 5;
+  clock_t start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    search(&big, -1); // 없는 값: 전체 순회
+  }
+  double indexed_time = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  int found = 0;
+  start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    for (PointerNode *current = pointer_nodes; current; current = current->next)
+    {
+      found += current->data == -1;
+    }
+  }
+  double pointer_time = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  // 번호 연결은 배열의 남는 칸까지 포함한 실제 할당량 기준
+  printf("%d개: 번호 연결 %.1f바이트/데이터, 순회 %.4f초 | 포인터 연결 %zu바이트/데이터, 순회 %.4f초 (찾음 %d)\n",
+         n, (double)big.pool.capacity * sizeof(Node) / n, indexed_time, sizeof(PointerNode), pointer_time, found);
+  free_list(&big);
+  free(pointer_nodes);
+  return 0;
+}
@@ -0,0 +1,625 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// 노드를 가리키는 32비트 번호 (노드 배열 안의 위치)
+// 64비트 포인터 대신 번호로 연결해 링크 크기를 절반으로 줄인다. 노드 수는 NIL 미만(약 40억 개)으로 제한된다.
+typedef uint32_t NodeIndex;
+
+// 노드가 없음을 나타내는 번호 (포인터 버전의 NULL)
+#define NIL UINT32_MAX
+
+// 번호로 연결하는 단일 연결 리스트의 노드를 나타내는 구조체 (8바이트, 포인터 버전은 16바이트)
+typedef struct Node
+{
+  int data;       // 노드에 저장된 데이터
+  NodeIndex next; // 다음 노드의 번호
+} Node;
+
+// 처음 할당하는 노드 배열의 크기
+#define INITIAL_CAPACITY 256
+
+// 노드 풀: 크기가 늘어나는 노드 배열과 반환된 노드를 재사용하기 위한 free list
+// 배열을 realloc으로 늘려 주소가 바뀌어도 번호는 그대로이므로 링크를 고칠 필요가 없다.
+typedef struct NodePool
+{
+  Node *nodes;          // 노드 배열
+  NodeIndex capacity;   // 배열 크기
+  NodeIndex used;       // 한 번이라도 쓰인 칸 수 (새 노드는 이 뒤에서 할당)
+  NodeIndex free_nodes; // 재사용 가능한 노드 목록 (next로 연결된 침습형 free list)
+} NodePool;
+
+// 단일 연결 리스트를 나타내는 구조체
+typedef struct SinglyLinkedList
+{
+  NodeIndex head;         // 리스트의 시작(head)
+  NodeIndex tail;         // 리스트의 끝(tail), append를 O(1)로 만들기 위해 유지
+  int size;               // 노드 수, length를 O(1)로 만들기 위해 유지
+  NodePool pool;          // 노드를 할당하는 리스트 전용 노드 풀
+  NodeIndex cursor;       // 마지막으로 get_nth로 접근한 노드 (NIL이면 없음)
+  int cursor_index;       // cursor의 위치
+} SinglyLinkedList;
+
+// 리스트를 처음부터 끝까지 O(n)에 순회하기 위한 반복자
+typedef struct ListIter
+{
+  const Node *nodes; // 리스트의 노드 배열 (순회 중 리스트를 수정하면 안 됨)
+  NodeIndex node;    // 현재 노드 (끝이면 NIL)
+  int index;         // 현재 위치
+} ListIter;
+
+// 노드 풀 초기화 함수
+void pool_init(NodePool *pool)
+{
+  pool->nodes = NULL;
+  pool->capacity = 0;
+  pool->used = 0;
+  pool->free_nodes = NIL;
+}
+
+// 배열에 빈 칸을 n개 이상 확보하는 함수
+// 두 배로 늘리되, 한 번에 그보다 많이 필요하면(list_append_array) 필요한 만큼만 늘린다.
+void pool_reserve(NodePool *pool, size_t n)
+{
+  size_t needed = (size_t)pool->used + n;
+  if (needed <= pool->capacity)
+  {
+    return;
+  }
+  if (needed >= NIL)
+  {
+    printf("노드 수가 32비트 번호 범위를 넘었습니다.\n");
+    abort();
+  }
+
+  size_t capacity = pool->capacity ? (size_t)pool->capacity * 2 : INITIAL_CAPACITY;
+  if (capacity < needed)
+  {
+    capacity = needed;
+  }
+  if (capacity >= NIL)
+  {
+    capacity = NIL - 1;
+  }
+  pool->nodes = (Node *)realloc(pool->nodes, capacity * sizeof(Node));
+  pool->capacity = (NodeIndex)capacity;
+}
+
+// 풀에서 노드 하나를 꺼내 번호를 반환하는 함수 (free list가 비면 배열 끝에서 할당)
+NodeIndex pool_alloc(NodePool *pool)
+{
+  if (pool->free_nodes != NIL)
+  {
+    NodeIndex node = pool->free_nodes;
+    pool->free_nodes = pool->nodes[node].next;
+    return node;
+  }
+  pool_reserve(pool, 1);
+  return pool->used++;
+}
+
+// 노드를 풀의 free list로 반환하는 함수
+void pool_free(NodePool *pool, NodeIndex node)
+{
+  pool->nodes[node].next = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+// 연속된 노드 n개를 배열 끝에서 할당해 첫 번호를 반환하는 함수 (free list를 거치지 않음)
+NodeIndex pool_alloc_block(NodePool *pool, size_t n)
+{
+  pool_reserve(pool, n);
+  NodeIndex first = pool->used;
+  pool->used += (NodeIndex)n;
+  return first;
+}
+
+// 노드 배열을 해제하는 함수 (free 한 번)
+void pool_destroy(NodePool *pool)
+{
+  free(pool->nodes);
+  pool_init(pool);
+}
+
+// 리스트 초기화 함수
+void init(SinglyLinkedList *list)
+{
+  list->head = NIL;
+  list->tail = NIL;
+  list->size = 0;
+  pool_init(&list->pool);
+  list->cursor = NIL;
+  list->cursor_index = 0;
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(SinglyLinkedList *list)
+{
+  return list->head == NIL;
+}
+
+// 리스트의 끝에 새 노드를 추가하는 함수
+void append(SinglyLinkedList *list, int data)
+{
+  NodeIndex new_node = pool_alloc(&list->pool);
+  Node *nodes = list->pool.nodes; // pool_alloc이 배열을 옮겼을 수 있으므로 할당 후에 읽음
+  nodes[new_node].data = data;
+  nodes[new_node].next = NIL;
+
+  if (is_empty(list))
+  {
+    list->head = new_node;
+  }
+  else
+  {
+    nodes[list->tail].next = new_node; // tail을 유지하므로 끝까지 순회할 필요 없음
+  }
+  list->tail = new_node;
+  list->size++;
+}
+
+// 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수
+// n개의 노드를 노드 배열의 연속된 칸에 순회 순서대로 놓으므로, 이후 순회는 메모리를 순서대로 읽는다.
+void list_append_array(SinglyLinkedList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+
+  NodeIndex first = pool_alloc_block(&list->pool, n);
+  Node *nodes = list->pool.nodes;
+  for (size_t i = 0; i < n; i++)
+  {
+    nodes[first + i].data = vals[i];
+    nodes[first + i].next = first + (NodeIndex)i + 1;
+  }
+  NodeIndex last = first + (NodeIndex)n - 1;
+  nodes[last].next = NIL;
+
+  if (is_empty(list))
+  {
+    list->head = first;
+  }
+  else
+  {
+    nodes[list->tail].next = first;
+  }
+  list->tail = last;
+  list->size += (int)n;
+}
+
+// 배열로 새 리스트를 만드는 함수 (append를 n번 호출하는 대신 할당 한 번)
+SinglyLinkedList list_from_array(const int *vals, size_t n)
+{
+  SinglyLinkedList list;
+  init(&list);
+  list_append_array(&list, vals, n);
+  return list;
+}
+
+// 리스트의 시작에 새 노드를 추가하는 함수
+void prepend(SinglyLinkedList *list, int data)
+{
+  NodeIndex new_node = pool_alloc(&list->pool);
+  Node *nodes = list->pool.nodes;
+  nodes[new_node].data = data;
+  nodes[new_node].next = list->head;
+  list->head = new_node;
+  if (list->tail == NIL)
+  {
+    list->tail = new_node;
+  }
+  list->size++;
+  list->cursor_index++; // 모든 노드의 위치가 한 칸씩 밀림
+}
+
+// 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
+void delete(SinglyLinkedList *list, int data)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다. 삭제할 수 없습니다.\n");
+    return;
+  }
+
+  Node *nodes = list->pool.nodes;
+  NodeIndex current = list->head;
+  NodeIndex prev = NIL;
+
+  while (current != NIL)
+  {
+    if (nodes[current].data == data)
+    {
+      if (prev != NIL)
+      {
+        nodes[prev].next = nodes[current].next;
+      }
+      else
+      {
+        list->head = nodes[current].next;
+      }
+      if (current == list->tail)
+      {
+        list->tail = prev; // 마지막 노드를 삭제하면 tail을 이전 노드로
+      }
+      pool_free(&list->pool, current);
+      list->size--;
+      list->cursor = NIL; // 위치가 바뀌므로 cursor를 버림
+      return;
+    }
+    prev = current;
+    current = nodes[current].next;
+  }
+  printf("리스트에 해당 데이터가 없습니다.\n");
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수
+int search(SinglyLinkedList *list, int data)
+{
+  const Node *nodes = list->pool.nodes;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    if (nodes[current].data == data)
+    {
+      return 1; // 데이터가 존재함
+    }
+  }
+  return 0; // 데이터가 없음
+}
+
+// 리스트의 내용을 출력하는 함수
+void show(SinglyLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  const Node *nodes = list->pool.nodes;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    printf("%d -> ", nodes[current].data);
+  }
+  printf("NULL\n");
+}
+
+// 리스트를 뒤집는 함수
+void reverse(SinglyLinkedList *list)
+{
+  Node *nodes = list->pool.nodes;
+  NodeIndex prev = NIL;
+  NodeIndex current = list->head;
+  NodeIndex next = NIL;
+
+  list->tail = list->head; // 기존 head가 뒤집힌 후의 tail
+  while (current != NIL)
+  {
+    next = nodes[current].next;
+    nodes[current].next = prev;
+    prev = current;
+    current = next;
+  }
+  list->head = prev;
+  list->cursor_index = list->size - 1 - list->cursor_index; // cursor 노드의 위치가 뒤집힘
+}
+
+// 리스트의 노드 수를 계산하는 함수
+int length(SinglyLinkedList *list)
+{
+  return list->size;
+}
+
+// 리스트의 중간 노드를 찾는 함수
+int find_middle(SinglyLinkedList *list)
+{
+  const Node *nodes = list->pool.nodes;
+  NodeIndex slow = list->head;
+  NodeIndex fast = list->head;
+
+  while (fast != NIL && nodes[fast].next != NIL)
+  {
+    slow = nodes[slow].next;
+    fast = nodes[nodes[fast].next].next;
+  }
+  return slow != NIL ? nodes[slow].data : -1;
+}
+
+// 리스트에서 N번째 노드 데이터를 찾는 함수
+// 마지막으로 접근한 위치(cursor)를 기억해 두고, n이 그 이후면 cursor부터 이어서 이동
+// (i = 0..n-1 순서로 호출해도 전체 O(n))
+int get_nth(SinglyLinkedList *list, int n)
+{
+  if (n < 0 || n >= list->size)
+  {
+    printf("인덱스가 범위를 벗어났습니다.\n");
+    return -1;
+  }
+
+  const Node *nodes = list->pool.nodes;
+  if (n == list->size - 1)
+  {
+    return nodes[list->tail].data;
+  }
+
+  NodeIndex current = list->head;
+  int count = 0;
+  if (list->cursor != NIL && list->cursor_index <= n)
+  {
+    current = list->cursor;
+    count = list->cursor_index;
+  }
+  while (count < n)
+  {
+    current = nodes[current].next;
+    count++;
+  }
+
+  list->cursor = current;
+  list->cursor_index = n;
+  return nodes[current].data;
+}
+
+// 메모리 해제 함수 (노드 배열을 통째로 해제)
+void free_list(SinglyLinkedList *list)
+{
+  pool_destroy(&list->pool);
+  list->head = NIL;
+  list->tail = NIL;
+  list->size = 0;
+  list->cursor = NIL;
+}
+
+// 반복자를 첫 노드에 두는 함수
+ListIter list_iter_begin(SinglyLinkedList *list)
+{
+  ListIter it = {list->pool.nodes, list->head, 0};
+  return it;
+}
+
+// 반복자가 끝에 도달했는지 확인하는 함수
+int list_iter_end(ListIter *it)
+{
+  return it->node == NIL;
+}
+
+// 반복자가 가리키는 노드의 데이터를 반환하는 함수
+int list_iter_data(ListIter *it)
+{
+  return it->nodes[it->node].data;
+}
+
+// 반복자를 다음 노드로 옮기는 함수
+void list_iter_next(ListIter *it)
+{
+  it->node = it->nodes[it->node].next;
+  it->index++;
+}
+
+// 리스트의 데이터를 앞에서부터 최대 max개까지 out 배열에 복사하는 함수 (부분 스냅샷)
+// 실제로 복사한 개수를 반환한다.
+int list_to_array_bounded(SinglyLinkedList *list, int *out, int max)
+{
+  const Node *nodes = list->pool.nodes;
+  int count = list->size < max ? list->size : max;
+  NodeIndex current = list->head;
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = nodes[current].data;
+    current = nodes[current].next;
+  }
+  return count;
+}
+
+// 리스트의 모든 데이터를 out 배열에 순서대로 복사하는 함수 (out은 length(list)개 이상)
+int list_to_array(SinglyLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+// 직렬화 형식을 확인하는 값과 형식 버전 (포인터 버전과 같은 형식이라 서로 읽고 쓸 수 있음)
+#define LIST_MAGIC "DSAL"
+#define LIST_FORMAT_VERSION 1
+// list_read가 한 번에 모아 list_append_array로 붙이는 데이터 수
+#define LIST_READ_CHUNK 4096
+
+// 부호 있는 차이를 작은 양수로 바꾸는 함수 (zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+uint64_t zigzag_encode(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t zigzag_decode(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// 7비트씩 나눠 기록하는 가변 길이 정수(varint)를 쓰는 함수 (작은 값일수록 짧음)
+void write_varint(FILE *fp, uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    putc((int)(v & 0x7F) | 0x80, fp);
+    v >>= 7;
+  }
+  putc((int)v, fp);
+}
+
+// varint를 읽는 함수 (성공하면 0, 파일이 끝났거나 형식이 틀리면 -1)
+int read_varint(FILE *fp, uint64_t *out)
+{
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    int c = getc(fp);
+    if (c == EOF)
+    {
+      return -1;
+    }
+    v |= (uint64_t)(c & 0x7F) << shift;
+    if (!(c & 0x80))
+    {
+      *out = v;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// 리스트를 이진 형식으로 기록하는 함수 (성공하면 0)
+// 형식: "DSAL" | 버전(1바이트) | 노드 수(varint) | 앞 데이터와의 차이(zigzag varint) x 노드 수
+int list_write(SinglyLinkedList *list, FILE *fp)
+{
+  fwrite(LIST_MAGIC, 1, 4, fp);
+  putc(LIST_FORMAT_VERSION, fp);
+  write_varint(fp, (uint64_t)list->size);
+
+  const Node *nodes = list->pool.nodes;
+  int64_t prev = 0;
+  for (NodeIndex current = list->head; current != NIL; current = nodes[current].next)
+  {
+    write_varint(fp, zigzag_encode((int64_t)nodes[current].data - prev));
+    prev = nodes[current].data;
+  }
+  return ferror(fp) ? -1 : 0;
+}
+
+// list_write로 기록한 리스트를 읽어 list의 끝에 추가하는 함수 (성공하면 0)
+// LIST_READ_CHUNK개씩 모아 list_append_array로 붙이므로 파일 전체를 메모리에 올리지 않는다.
+int list_read(SinglyLinkedList *list, FILE *fp)
+{
+  char magic[4];
+  uint64_t count;
+  if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LIST_MAGIC, 4) != 0 ||
+      getc(fp) != LIST_FORMAT_VERSION || read_varint(fp, &count) != 0)
+  {
+    printf("리스트 파일 형식이 맞지 않습니다.\n");
+    return -1;
+  }
+
+  int buffer[LIST_READ_CHUNK];
+  int filled = 0;
+  int64_t prev = 0;
+  for (uint64_t i = 0; i < count; i++)
+  {
+    uint64_t v;
+    if (read_varint(fp, &v) != 0)
+    {
+      list_append_array(list, buffer, filled); // 읽은 데까지는 붙여 둠
+      printf("리스트 파일이 중간에 끝났습니다.\n");
+      return -1;
+    }
+    prev += zigzag_decode(v);
+    buffer[filled++] = (int)prev;
+    if (filled == LIST_READ_CHUNK)
+    {
+      list_append_array(list, buffer, filled);
+      filled = 0;
+    }
+  }
+  list_append_array(list, buffer, filled);
+  return 0;
+}
+
+// 비교용: 포인터로 연결하는 기존 단일 연결 리스트의 노드
+typedef struct PointerNode
+{
+  int data;
+  struct PointerNode *next;
+} PointerNode;
+
+// 사용 예제
+int main()
+{
+  SinglyLinkedList sll;
+  init(&sll);
+  append(&sll, 10);
+  append(&sll, 20);
+  append(&sll, 30);
+  show(&sll);
+  prepend(&sll, 5);
+  show(&sll);
+  delete (&sll, 20);
+  show(&sll);
+  printf("10 검색: %d\n", search(&sll, 10));
+  printf("40 검색: %d\n", search(&sll, 40));
+  printf("리스트 길이: %d\n", length(&sll));
+  reverse(&sll);
+  show(&sll);
+  printf("중간 노드: %d\n", find_middle(&sll));
+  printf("2번째 노드: %d\n", get_nth(&sll, 2));
+  // 반복자로 전체를 O(n)에 순회
+  for (ListIter it = list_iter_begin(&sll); !list_iter_end(&it); list_iter_next(&it))
+  {
+    printf("[%d]=%d ", it.index, list_iter_data(&it));
+  }
+  printf("\n");
+  free_list(&sll);
+  // 배열에서 한 번에 리스트 만들기 (노드가 배열의 연속된 칸에 놓임)
+  int small[] = {1, 2, 3, 4, 5};
+  SinglyLinkedList bulk = list_from_array(small, 5);
+  list_append_array(&bulk, small, 2);
+  show(&bulk);
+  // 배열로 복사 (전체와 앞쪽 2개만)
+  int snapshot[8] = {0};
+  int copied = list_to_array(&bulk, snapshot);
+  printf("배열로 복사한 개수: %d, 마지막 값: %d\n", copied, snapshot[copied - 1]);
+  copied = list_to_array_bounded(&bulk, snapshot, 2);
+  printf("부분 스냅샷: %d개 [%d, %d]\n", copied, snapshot[0], snapshot[1]);
+  // 이진 형식으로 저장했다가 다시 읽기
+  FILE *fp = tmpfile();
+  list_write(&bulk, fp);
+  rewind(fp);
+  SinglyLinkedList loaded;
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  show(&loaded);
+  free_list(&loaded);
+  free_list(&bulk);
+
+  // 데이터당 메모리와 순회 속도를 포인터 버전과 비교 (두 리스트 모두 노드를 순서대로 연속 배치)
+  int n = 10000000;
+  int *values = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    values[i] = i;
+  }
+  SinglyLinkedList big = list_from_array(values, n);
+  PointerNode *pointer_nodes = (PointerNode *)malloc(n * sizeof(PointerNode));
+  for (int i = 0; i < n; i++)
+  {
+    pointer_nodes[i].data = values[i];
+    pointer_nodes[i].next = (i + 1 < n) ? &pointer_nodes[i + 1] : NULL;
+  }
+  free(values);
+
+  int scans = 5;
+  clock_t start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    search(&big, -1); // 없는 값: 전체 순회
+  }
+  double indexed_time = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  int found = 0;
+  start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    for (PointerNode *current = pointer_nodes; current; current = current->next)
+    {
+      found += current->data == -1;
+    }
+  }
+  double pointer_time = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  // 번호 연결은 배열의 남는 칸까지 포함한 실제 할당량 기준
+  printf("%d개: 번호 연결 %.1f바이트/데이터, 순회 %.4f초 | 포인터 연결 %zu바이트/데이터, 순회 %.4f초 (찾음 %d)\n",
+         n, (double)big.pool.capacity * sizeof(Node) / n, indexed_time, sizeof(PointerNode), pointer_time, found);
+  free_list(&big);
+  free(pointer_nodes);
+  return 0;
+}
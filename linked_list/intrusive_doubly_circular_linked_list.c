@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+/*
+ * container_of 매크로
+ *  - 링크 필드의 주소(ptr)에서 그 링크를 품고 있는 객체(type)의 주소를 구함
+ */
+#define container_of(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+/*
+ * 침습형(intrusive) 이중 원형 연결 리스트의 링크 구조체
+ *  - 사용자가 자신의 구조체 안에 이 링크를 넣어 두고, 리스트는 링크만 연결
+ *  - next: 다음 링크를 가리키는 포인터
+ *  - prev: 이전 링크를 가리키는 포인터
+ */
+typedef struct ListLink
+{
+  struct ListLink *next;
+  struct ListLink *prev;
+} ListLink;
+
+/*
+ * 침습형 이중 원형 연결 리스트를 나타내는 구조체
+ *  - head: 리스트의 시작 링크 (tail은 항상 head->prev)
+ *  - size: 연결된 링크 수
+ *  - 리스트는 노드를 할당하지 않으므로 free_list가 없음 (객체 수명은 사용자가 관리)
+ */
+typedef struct IntrusiveList
+{
+  ListLink *head;
+  int size;
+} IntrusiveList;
+
+/*
+ * 리스트 초기화 함수
+ */
+void init(IntrusiveList *list)
+{
+  list->head = NULL;
+  list->size = 0;
+}
+
+/*
+ * 리스트가 비어 있는지 확인하는 함수
+ */
+int is_empty(IntrusiveList *list)
+{
+  return (list->head == NULL);
+}
+
+/*
+ * pos 링크 바로 뒤에 link를 연결하는 함수 (insert_after)
+ *  - 원형 구조이므로 앞뒤 링크가 항상 존재해 분기 없이 연결 가능
+ */
+void insert_after(IntrusiveList *list, ListLink *pos, ListLink *link)
+{
+  link->prev = pos;
+  link->next = pos->next;
+  pos->next->prev = link;
+  pos->next = link;
+  list->size++;
+}
+
+/*
+ * pos 링크 바로 앞에 link를 연결하는 함수 (insert_before)
+ *  - pos가 head이면 link는 새 tail이 됨 (head는 그대로)
+ */
+void insert_before(IntrusiveList *list, ListLink *pos, ListLink *link)
+{
+  insert_after(list, pos->prev, link);
+}
+
+/*
+ * 리스트의 끝에 링크를 연결하는 함수 (append, 할당 없음)
+ *  - 비어 있으면 자기 자신을 가리키도록 만들고 head로 지정
+ *  - 아니면 head 앞(= tail 뒤)에 연결
+ */
+void append(IntrusiveList *list, ListLink *link)
+{
+  if (is_empty(list))
+  {
+    link->next = link;
+    link->prev = link;
+    list->head = link;
+    list->size = 1;
+    return;
+  }
+  insert_before(list, list->head, link);
+}
+
+/*
+ * 리스트의 시작에 링크를 연결하는 함수 (prepend, 할당 없음)
+ *  - append 후 head를 새 링크로 옮김
+ */
+void prepend(IntrusiveList *list, ListLink *link)
+{
+  append(list, link);
+  list->head = link;
+}
+
+/*
+ * 링크를 리스트에서 떼어내는 함수 (remove_link)
+ *  - 검색 없이 O(1), 객체는 해제하지 않음
+ *  - 떼어낸 링크가 head이면 head를 다음 링크로 옮김
+ */
+void remove_link(IntrusiveList *list, ListLink *link)
+{
+  if (link->next == link)
+  {
+    list->head = NULL;
+  }
+  else
+  {
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    if (link == list->head)
+    {
+      list->head = link->next;
+    }
+  }
+  link->next = NULL;
+  link->prev = NULL;
+  list->size--;
+}
+
+/*
+ * 조건을 만족하는 첫 번째 링크를 찾는 함수 (search)
+ *  - head부터 한 바퀴 순회하며 match가 참인 링크를 반환 (없으면 NULL)
+ */
+ListLink *search(IntrusiveList *list, int (*match)(ListLink *link, void *arg), void *arg)
+{
+  if (is_empty(list))
+    return NULL;
+
+  ListLink *current = list->head;
+  do
+  {
+    if (match(current, arg))
+    {
+      return current;
+    }
+    current = current->next;
+  } while (current != list->head);
+
+  return NULL;
+}
+
+/*
+ * 리스트를 뒤집는 함수 (reverse)
+ *  - 각 링크의 next와 prev를 교환한 뒤, 기존 tail을 새 head로 지정
+ */
+void reverse(IntrusiveList *list)
+{
+  if (is_empty(list))
+    return;
+
+  ListLink *current = list->head;
+  ListLink *temp = NULL;
+  do
+  {
+    temp = current->prev;
+    current->prev = current->next;
+    current->next = temp;
+    current = current->prev;
+  } while (current != list->head);
+
+  list->head = list->head->next;
+}
+
+/*
+ * 리스트의 링크 수를 반환하는 함수 (length)
+ */
+int length(IntrusiveList *list)
+{
+  return list->size;
+}
+
+/*
+ * 사용 예제에서 쓸 사용자 구조체
+ *  - id: 데이터
+ *  - link: 리스트 연결용 링크 (객체 안에 포함)
+ */
+typedef struct Task
+{
+  int id;
+  ListLink link;
+} Task;
+
+/*
+ * Task의 id가 arg가 가리키는 값과 같은지 확인하는 함수
+ */
+int task_has_id(ListLink *link, void *arg)
+{
+  return container_of(link, Task, link)->id == *(int *)arg;
+}
+
+/*
+ * Task 리스트의 내용을 출력하는 함수 (show)
+ */
+void show(IntrusiveList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  ListLink *current = list->head;
+  do
+  {
+    printf("%d <-> ", container_of(current, Task, link)->id);
+    current = current->next;
+  } while (current != list->head);
+  printf("(다시 head)\n");
+}
+
+/*
+ * 사용 예제 (테스트 코드)
+ *  - 이미 존재하는 객체들을 할당 없이 연결하고, 링크로 O(1) 제거
+ */
+int main()
+{
+  Task tasks[4] = {{.id = 5}, {.id = 10}, {.id = 20}, {.id = 30}};
+  IntrusiveList list;
+  init(&list);
+
+  append(&list, &tasks[1].link);
+  append(&list, &tasks[2].link);
+  append(&list, &tasks[3].link);
+  show(&list);
+
+  prepend(&list, &tasks[0].link);
+  show(&list);
+
+  remove_link(&list, &tasks[2].link);
+  show(&list);
+
+  insert_after(&list, &tasks[1].link, &tasks[2].link);
+  show(&list);
+
+  int key = 30;
+  ListLink *found = search(&list, task_has_id, &key);
+  printf("30 검색: %d\n", found ? container_of(found, Task, link)->id : -1);
+
+  printf("리스트 길이: %d\n", length(&list));
+
+  reverse(&list);
+  show(&list);
+  return 0;
+}
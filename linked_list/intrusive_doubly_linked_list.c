@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+// 링크 필드의 주소로부터 그 링크를 품고 있는 객체의 주소를 구하는 매크로
+#define container_of(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+// 침습형(intrusive) 이중 연결 리스트의 링크
+// 사용자가 자신의 구조체 안에 이 링크를 넣어 두고, 리스트는 링크만 연결한다.
+typedef struct ListLink
+{
+  struct ListLink *next; // 다음 링크를 가리키는 포인터
+  struct ListLink *prev; // 이전 링크를 가리키는 포인터
+} ListLink;
+
+// 침습형 이중 연결 리스트를 나타내는 구조체
+// 리스트는 노드를 할당하지 않으므로 free_list가 없다. 객체의 수명은 사용자가 관리한다.
+typedef struct IntrusiveList
+{
+  ListLink *head; // 리스트의 시작(head)
+  ListLink *tail; // 리스트의 끝(tail)
+  int size;       // 연결된 링크 수
+} IntrusiveList;
+
+// 리스트 초기화 함수
+void init(IntrusiveList *list)
+{
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(IntrusiveList *list)
+{
+  return list->head == NULL;
+}
+
+// 리스트의 끝에 링크를 연결하는 함수 (할당 없음)
+void append(IntrusiveList *list, ListLink *link)
+{
+  link->next = NULL;
+  link->prev = list->tail;
+  if (is_empty(list))
+  {
+    list->head = link;
+  }
+  else
+  {
+    list->tail->next = link;
+  }
+  list->tail = link;
+  list->size++;
+}
+
+// 리스트의 시작에 링크를 연결하는 함수 (할당 없음)
+void prepend(IntrusiveList *list, ListLink *link)
+{
+  link->next = list->head;
+  link->prev = NULL;
+  if (is_empty(list))
+  {
+    list->tail = link;
+  }
+  else
+  {
+    list->head->prev = link;
+  }
+  list->head = link;
+  list->size++;
+}
+
+// pos 링크 바로 뒤에 link를 연결하는 함수
+void insert_after(IntrusiveList *list, ListLink *pos, ListLink *link)
+{
+  link->prev = pos;
+  link->next = pos->next;
+  if (pos->next)
+  {
+    pos->next->prev = link;
+  }
+  else
+  {
+    list->tail = link;
+  }
+  pos->next = link;
+  list->size++;
+}
+
+// pos 링크 바로 앞에 link를 연결하는 함수
+void insert_before(IntrusiveList *list, ListLink *pos, ListLink *link)
+{
+  link->next = pos;
+  link->prev = pos->prev;
+  if (pos->prev)
+  {
+    pos->prev->next = link;
+  }
+  else
+  {
+    list->head = link;
+  }
+  pos->prev = link;
+  list->size++;
+}
+
+// 링크를 리스트에서 떼어내는 함수 (검색 없이 O(1), 객체는 해제하지 않음)
+void remove_link(IntrusiveList *list, ListLink *link)
+{
+  if (link->prev)
+  {
+    link->prev->next = link->next;
+  }
+  else
+  {
+    list->head = link->next;
+  }
+
+  if (link->next)
+  {
+    link->next->prev = link->prev;
+  }
+  else
+  {
+    list->tail = link->prev;
+  }
+  link->next = NULL;
+  link->prev = NULL;
+  list->size--;
+}
+
+// 조건을 만족하는 첫 번째 링크를 찾는 함수 (없으면 NULL)
+ListLink *search(IntrusiveList *list, int (*match)(ListLink *link, void *arg), void *arg)
+{
+  ListLink *current = list->head;
+  while (current)
+  {
+    if (match(current, arg))
+    {
+      return current;
+    }
+    current = current->next;
+  }
+  return NULL;
+}
+
+// 리스트를 뒤집는 함수
+void reverse(IntrusiveList *list)
+{
+  ListLink *current = list->head;
+  ListLink *temp = NULL;
+
+  list->head = list->tail;
+  list->tail = current;
+  while (current)
+  {
+    temp = current->prev;
+    current->prev = current->next;
+    current->next = temp;
+    current = current->prev;
+  }
+}
+
+// 리스트의 링크 수를 반환하는 함수
+int length(IntrusiveList *list)
+{
+  return list->size;
+}
+
+// 사용 예제에서 쓸 사용자 구조체 (링크를 멤버로 품고 있음)
+typedef struct Task
+{
+  int id;
+  ListLink link; // 리스트 연결용 링크
+} Task;
+
+// Task의 id가 arg가 가리키는 값과 같은지 확인하는 함수
+int task_has_id(ListLink *link, void *arg)
+{
+  return container_of(link, Task, link)->id == *(int *)arg;
+}
+
+// Task 리스트의 내용을 출력하는 함수
+void show(IntrusiveList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  ListLink *current = list->head;
+  while (current)
+  {
+    printf("%d <-> ", container_of(current, Task, link)->id);
+    current = current->next;
+  }
+  printf("NULL\n");
+}
+
+// 사용 예제
+int main()
+{
+  // 객체는 이미 존재하고, 리스트는 링크만 연결한다 (삽입/삭제 시 할당 없음)
+  Task tasks[4] = {{.id = 5}, {.id = 10}, {.id = 20}, {.id = 30}};
+  IntrusiveList list;
+  init(&list);
+  append(&list, &tasks[1].link);
+  append(&list, &tasks[2].link);
+  append(&list, &tasks[3].link);
+  show(&list);
+  prepend(&list, &tasks[0].link);
+  show(&list);
+
+  // 객체의 링크만 알면 검색 없이 O(1)로 제거
+  remove_link(&list, &tasks[2].link);
+  show(&list);
+  insert_after(&list, &tasks[1].link, &tasks[2].link);
+  show(&list);
+
+  int key = 30;
+  ListLink *found = search(&list, task_has_id, &key);
+  printf("30 검색: %d\n", found ? container_of(found, Task, link)->id : -1);
+  printf("리스트 길이: %d\n", length(&list));
+  reverse(&list);
+  show(&list);
+  return 0;
+}
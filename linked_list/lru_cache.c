@@ -0,0 +1,436 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * LRU 캐시
+ *  - 이중 원형 연결 리스트로 사용 순서를 관리 (head = 가장 최근, head->prev = 가장 오래됨)
+ *  - 오픈 어드레싱(선형 탐사) 해시 테이블로 key -> 노드를 찾음
+ *  - get/put/touch/evict_tail 모두 리스트 순회 없이 O(1)
+ */
+
+/*
+ * 캐시 항목(노드) 구조체
+ *  - key, value: 캐시에 저장된 키와 값
+ *  - next, prev: 이중 원형 연결 리스트의 다음/이전 노드
+ */
+typedef struct Node
+{
+  int key;
+  int value;
+  struct Node *next;
+  struct Node *prev;
+} Node;
+
+/*
+ * LRU 캐시 구조체
+ *  - head: 가장 최근에 사용한 노드 (tail은 항상 head->prev)
+ *  - size, capacity: 현재 항목 수와 최대 항목 수
+ *  - nodes: capacity개의 노드를 한 번에 할당한 배열 (put에서 malloc 없음)
+ *  - free_nodes: 사용하지 않는 노드 목록 (next로 연결)
+ *  - slots: 해시 테이블, 각 칸은 노드를 가리키거나 NULL
+ *  - slot_mask: 해시 테이블 크기 - 1 (크기는 2의 거듭제곱)
+ *  - on_evict: 항목이 밀려날 때 호출되는 콜백 (NULL 가능)
+ */
+typedef struct LRUCache
+{
+  Node *head;
+  int size;
+  int capacity;
+  Node *nodes;
+  Node *free_nodes;
+  Node **slots;
+  unsigned slot_mask;
+  void (*on_evict)(int key, int value, void *arg);
+  void *evict_arg;
+} LRUCache;
+
+/*
+ * 키의 해시 값을 구하는 함수 (피보나치 해싱)
+ */
+unsigned hash_key(int key)
+{
+  unsigned h = (unsigned)key * 2654435769u;
+  return h ^ (h >> 16);
+}
+
+/*
+ * 캐시 초기화 함수 (lru_init)
+ *  - 해시 테이블은 capacity의 2배 이상인 2의 거듭제곱 크기로 잡아 탐사 길이를 짧게 유지
+ *  - 노드 capacity개를 미리 할당해 free list에 연결
+ *  - capacity가 0 이하이면 아무것도 저장하지 않는 캐시가 됨 (lru_put이 넣지 않고 돌아감)
+ */
+void lru_init(LRUCache *cache, int capacity, void (*on_evict)(int key, int value, void *arg), void *evict_arg)
+{
+  if (capacity < 0)
+    capacity = 0;
+
+  unsigned slot_count = 2;
+  while (slot_count < (unsigned)capacity * 2)
+  {
+    slot_count <<= 1;
+  }
+
+  cache->head = NULL;
+  cache->size = 0;
+  cache->capacity = capacity;
+  cache->nodes = (Node *)malloc(capacity * sizeof(Node));
+  cache->slots = (Node **)calloc(slot_count, sizeof(Node *));
+  cache->slot_mask = slot_count - 1;
+  cache->on_evict = on_evict;
+  cache->evict_arg = evict_arg;
+
+  cache->free_nodes = NULL;
+  for (int i = capacity - 1; i >= 0; i--)
+  {
+    cache->nodes[i].next = cache->free_nodes;
+    cache->free_nodes = &cache->nodes[i];
+  }
+}
+
+/*
+ * 키가 들어 있는 해시 칸의 위치를 찾는 함수 (find_slot)
+ *  - 키가 있으면 그 칸, 없으면 처음 만난 빈 칸의 위치를 반환
+ */
+unsigned find_slot(LRUCache *cache, int key)
+{
+  unsigned i = hash_key(key) & cache->slot_mask;
+  while (cache->slots[i] && cache->slots[i]->key != key)
+  {
+    i = (i + 1) & cache->slot_mask;
+  }
+  return i;
+}
+
+/*
+ * 해시 칸을 비우는 함수 (remove_slot)
+ *  - 선형 탐사이므로 뒤따르는 칸들을 당겨 와서 탐사 체인이 끊기지 않게 함 (묘비 없음)
+ */
+void remove_slot(LRUCache *cache, unsigned hole)
+{
+  unsigned i = hole;
+  while (1)
+  {
+    i = (i + 1) & cache->slot_mask;
+    if (!cache->slots[i])
+      break;
+
+    // i에 있는 항목의 원래 위치가 (hole, i] 구간 밖이면 hole로 옮길 수 있음
+    unsigned home = hash_key(cache->slots[i]->key) & cache->slot_mask;
+    if (((i - home) & cache->slot_mask) >= ((i - hole) & cache->slot_mask))
+    {
+      cache->slots[hole] = cache->slots[i];
+      hole = i;
+    }
+  }
+  cache->slots[hole] = NULL;
+}
+
+/*
+ * 노드를 원형 리스트에서 떼어내는 함수 (unlink_node)
+ */
+void unlink_node(LRUCache *cache, Node *node)
+{
+  if (node->next == node)
+  {
+    cache->head = NULL;
+    return;
+  }
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+  if (node == cache->head)
+  {
+    cache->head = node->next;
+  }
+}
+
+/*
+ * 노드를 원형 리스트의 맨 앞(가장 최근)에 넣는 함수 (push_front)
+ */
+void push_front(LRUCache *cache, Node *node)
+{
+  if (!cache->head)
+  {
+    node->next = node;
+    node->prev = node;
+  }
+  else
+  {
+    Node *tail = cache->head->prev;
+    node->next = cache->head;
+    node->prev = tail;
+    tail->next = node;
+    cache->head->prev = node;
+  }
+  cache->head = node;
+}
+
+/*
+ * 노드를 맨 앞으로 옮기는 함수 (move_to_front)
+ *  - 이미 head이면 아무것도 하지 않음
+ */
+void move_to_front(LRUCache *cache, Node *node)
+{
+  if (node == cache->head)
+    return;
+  // 노드가 tail이면 head를 한 칸 뒤로 돌리기만 하면 됨 (원형 리스트의 이점)
+  if (node == cache->head->prev)
+  {
+    cache->head = node;
+    return;
+  }
+  unlink_node(cache, node);
+  push_front(cache, node);
+}
+
+/*
+ * 가장 오래된 항목을 내보내는 함수 (lru_evict_tail)
+ *  - 콜백이 있으면 호출한 뒤 노드를 free list로 반환
+ *  - 비어 있으면 0, 내보냈으면 1 반환
+ */
+int lru_evict_tail(LRUCache *cache)
+{
+  if (!cache->head)
+    return 0;
+
+  Node *tail = cache->head->prev;
+  if (cache->on_evict)
+  {
+    cache->on_evict(tail->key, tail->value, cache->evict_arg);
+  }
+  remove_slot(cache, find_slot(cache, tail->key));
+  unlink_node(cache, tail);
+  tail->next = cache->free_nodes;
+  cache->free_nodes = tail;
+  cache->size--;
+  return 1;
+}
+
+/*
+ * 키로 값을 조회하는 함수 (lru_get)
+ *  - 있으면 *value에 값을 쓰고 가장 최근으로 옮긴 뒤 1 반환, 없으면 0
+ */
+int lru_get(LRUCache *cache, int key, int *value)
+{
+  Node *node = cache->slots[find_slot(cache, key)];
+  if (!node)
+    return 0;
+
+  move_to_front(cache, node);
+  *value = node->value;
+  return 1;
+}
+
+/*
+ * 키의 사용 순서만 갱신하는 함수 (lru_touch)
+ *  - 있으면 가장 최근으로 옮기고 1, 없으면 0 반환
+ */
+int lru_touch(LRUCache *cache, int key)
+{
+  Node *node = cache->slots[find_slot(cache, key)];
+  if (!node)
+    return 0;
+
+  move_to_front(cache, node);
+  return 1;
+}
+
+/*
+ * 키와 값을 넣는 함수 (lru_put)
+ *  - 이미 있는 키이면 값을 갱신하고 가장 최근으로 옮김
+ *  - 새 키인데 가득 찼으면 가장 오래된 항목을 먼저 내보냄
+ *  - 쓸 수 있는 노드가 없으면(capacity가 0) 아무것도 하지 않음
+ */
+void lru_put(LRUCache *cache, int key, int value)
+{
+  unsigned slot = find_slot(cache, key);
+  Node *node = cache->slots[slot];
+  if (node)
+  {
+    node->value = value;
+    move_to_front(cache, node);
+    return;
+  }
+
+  if (cache->size == cache->capacity)
+  {
+    lru_evict_tail(cache);
+    // 내보내면서 해시 칸이 당겨졌을 수 있으므로 다시 찾음
+    slot = find_slot(cache, key);
+  }
+
+  node = cache->free_nodes;
+  if (!node)
+    return;
+  cache->free_nodes = node->next;
+  node->key = key;
+  node->value = value;
+  cache->slots[slot] = node;
+  push_front(cache, node);
+  cache->size++;
+}
+
+/*
+ * 캐시 내용을 최근 사용 순으로 출력하는 함수 (lru_show)
+ */
+void lru_show(LRUCache *cache)
+{
+  if (!cache->head)
+  {
+    printf("캐시가 비어 있습니다.\n");
+    return;
+  }
+
+  Node *current = cache->head;
+  do
+  {
+    printf("%d:%d <-> ", current->key, current->value);
+    current = current->next;
+  } while (current != cache->head);
+  printf("(다시 head)\n");
+}
+
+/*
+ * 메모리 해제 함수 (lru_free)
+ *  - 노드 배열과 해시 테이블을 한 번에 해제
+ */
+void lru_free(LRUCache *cache)
+{
+  free(cache->nodes);
+  free(cache->slots);
+  cache->nodes = NULL;
+  cache->slots = NULL;
+  cache->free_nodes = NULL;
+  cache->head = NULL;
+  cache->size = 0;
+}
+
+/*
+ * 사용 예제에서 쓰는 콜백: 밀려난 항목을 출력
+ */
+void print_evicted(int key, int value, void *arg)
+{
+  (void)arg;
+  printf("  밀려남 -> %d:%d\n", key, value);
+}
+
+/*
+ * 사용 예제에서 쓰는 콜백: 밀려난 횟수만 셈
+ */
+void count_evicted(int key, int value, void *arg)
+{
+  (void)key;
+  (void)value;
+  (*(long *)arg)++;
+}
+
+/*
+ * Zipf 분포(s = 1)를 따르는 키를 뽑기 위한 누적 분포를 만드는 함수
+ *  - 키 k(0부터)의 가중치는 1 / (k + 1)
+ */
+double *make_zipf_cdf(int key_count)
+{
+  double *cdf = (double *)malloc(key_count * sizeof(double));
+  double sum = 0;
+  for (int k = 0; k < key_count; k++)
+  {
+    sum += 1.0 / (k + 1);
+    cdf[k] = sum;
+  }
+  for (int k = 0; k < key_count; k++)
+  {
+    cdf[k] /= sum;
+  }
+  return cdf;
+}
+
+/*
+ * 누적 분포에서 이분 탐색으로 키 하나를 뽑는 함수
+ */
+int sample_zipf(const double *cdf, int key_count, unsigned *state)
+{
+  // xorshift32 난수
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  double u = (double)*state / 4294967296.0;
+
+  int lo = 0, hi = key_count - 1;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (cdf[mid] < u)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+/*
+ * 사용 예제 (테스트 코드)
+ *  - 기본 동작을 보여준 뒤, 로컬에서 만든 Zipf 접근 패턴으로 적중률과 처리량을 측정
+ */
+int main()
+{
+  LRUCache cache;
+  lru_init(&cache, 3, print_evicted, NULL);
+
+  lru_put(&cache, 1, 100);
+  lru_put(&cache, 2, 200);
+  lru_put(&cache, 3, 300);
+  lru_show(&cache);
+
+  int value;
+  if (lru_get(&cache, 1, &value))
+  {
+    printf("1 조회: %d\n", value);
+  }
+  lru_show(&cache);
+
+  lru_put(&cache, 4, 400); // 가장 오래된 2가 밀려남
+  lru_show(&cache);
+
+  lru_touch(&cache, 3);
+  lru_show(&cache);
+
+  lru_evict_tail(&cache);
+  lru_show(&cache);
+  printf("2 조회: %d\n", lru_get(&cache, 2, &value));
+  lru_free(&cache);
+
+  // Zipf 접근 패턴 (키 100만 개 중 1만 개만 캐시)
+  int key_count = 1000000;
+  int ops = 5000000;
+  long evictions = 0;
+  long hits = 0;
+  unsigned state = 12345;
+  double *cdf = make_zipf_cdf(key_count);
+  int *trace = (int *)malloc(ops * sizeof(int));
+  for (int i = 0; i < ops; i++)
+  {
+    trace[i] = sample_zipf(cdf, key_count, &state);
+  }
+
+  lru_init(&cache, 10000, count_evicted, &evictions);
+  clock_t start = clock();
+  for (int i = 0; i < ops; i++)
+  {
+    if (lru_get(&cache, trace[i], &value))
+    {
+      hits++;
+    }
+    else
+    {
+      lru_put(&cache, trace[i], i);
+    }
+  }
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  printf("Zipf 접근 %d회: 적중률 %.1f%%, 밀려남 %ld회, 초당 %.0f만 회\n",
+         ops, 100.0 * hits / ops, evictions, seconds > 0 ? ops / seconds / 10000 : 0);
+
+  lru_free(&cache);
+  free(trace);
+  free(cdf);
+  return 0;
+}
@@ -0,0 +1,551 @@
+// 컴파일: gcc -O2 persistent_linked_list.c (POSIX mmap 사용)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+
+/*
+ * 파일에 저장되는 영속(persistent) 이중 연결 리스트
+ *  - 노드를 mmap한 파일 안에 두고, 포인터 대신 파일 시작으로부터의 오프셋으로 연결
+ *  - 오프셋은 파일이 어느 주소에 매핑되든 그대로 유효하므로, 재시작 시 파일을 매핑하기만 하면 바로 사용 가능
+ *    (파싱이나 노드 할당 단계가 없음)
+ *  - list_sync를 호출한 시점이 내구성 보장 지점: 그 이전의 변경은 디스크에 기록됨
+ *  - list_sync 사이에 프로세스가 죽으면 마지막 변경이 일부만 기록될 수 있음 (저널 없음, 열 때 경고)
+ */
+
+// 파일 형식을 확인하는 값 ("DSALIST1")
+#define LIST_MAGIC 0x315453494C415344ULL
+#define LIST_VERSION 1
+// 오프셋 0은 파일 헤더 자리이므로 "노드 없음(NULL)"으로 사용
+#define NIL 0
+// 새 파일의 처음 노드 수
+#define INITIAL_CAPACITY 1024
+// 시작 시간 비교에 쓰는 노드 수 (컴파일할 때 -DBENCH_NODES=... 로 바꿀 수 있음)
+// 파일 크기는 노드 수 x 24바이트이므로 기본값은 약 24MB로 작게 둔다. 100000000이면 약 2.4GB.
+#ifndef BENCH_NODES
+#define BENCH_NODES 1000000
+#endif
+
+// 파일에 저장되는 노드 (포인터 대신 오프셋)
+typedef struct Node
+{
+  uint64_t next; // 다음 노드의 오프셋 (NIL이면 끝)
+  uint64_t prev; // 이전 노드의 오프셋 (NIL이면 처음)
+  int data;      // 노드에 저장된 데이터
+} Node;
+
+// 파일 맨 앞에 저장되는 헤더 (리스트의 상태 전체)
+typedef struct FileHeader
+{
+  uint64_t magic;     // LIST_MAGIC
+  uint32_t version;   // 파일 형식 버전
+  uint32_t node_size; // sizeof(Node), 다른 구조로 만든 파일을 잘못 여는 것을 막음
+  uint64_t capacity;  // 파일에 들어갈 수 있는 노드 수
+  uint64_t used;      // 한 번이라도 쓰인 노드 칸 수 (새 노드는 이 뒤에서 할당)
+  uint64_t head;      // 첫 노드의 오프셋
+  uint64_t tail;      // 마지막 노드의 오프셋
+  uint64_t free_head; // 삭제된 노드 목록 (next로 연결, 재사용)
+  uint64_t size;      // 노드 수
+  uint64_t dirty;     // 마지막 list_sync 이후 변경이 있으면 1
+} FileHeader;
+
+// 매핑된 영속 리스트를 나타내는 구조체 (이 구조체 자체는 저장되지 않음)
+typedef struct PersistentList
+{
+  int fd;           // 리스트 파일
+  char *base;       // 파일이 매핑된 주소 (실행할 때마다 달라질 수 있음)
+  size_t mapped;    // 매핑된 바이트 수
+  FileHeader *hdr;  // base에 있는 헤더
+} PersistentList;
+
+// 노드 칸 i의 오프셋 (헤더 바로 뒤부터 노드 배열)
+uint64_t slot_offset(uint64_t i)
+{
+  return sizeof(FileHeader) + i * sizeof(Node);
+}
+
+// 오프셋을 현재 매핑의 주소로 바꾸는 함수
+Node *at(PersistentList *list, uint64_t off)
+{
+  return (Node *)(list->base + off);
+}
+
+// 노드 capacity개를 담는 파일 크기
+size_t file_bytes(uint64_t capacity)
+{
+  return slot_offset(capacity);
+}
+
+// 헤더에 적힌 오프셋이 NIL이거나, 이미 쓰인 노드 칸의 시작을 가리키는지 확인하는 함수
+int valid_offset(FileHeader *hdr, uint64_t off)
+{
+  if (off == NIL)
+  {
+    return 1;
+  }
+  return off >= sizeof(FileHeader) && off < slot_offset(hdr->used) && (off - sizeof(FileHeader)) % sizeof(Node) == 0;
+}
+
+// 파일을 bytes 크기로 (다시) 매핑하는 함수 (성공하면 0)
+// 새 매핑을 먼저 만들고 성공했을 때만 바꾸므로, 실패해도 기존 매핑은 그대로 쓸 수 있다.
+int remap(PersistentList *list, size_t bytes)
+{
+  void *base = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, list->fd, 0);
+  if (base == MAP_FAILED)
+  {
+    return -1;
+  }
+  char *old_base = list->base;
+  size_t old_mapped = list->mapped;
+  list->base = (char *)base;
+  list->mapped = bytes;
+  list->hdr = (FileHeader *)base;
+  if (old_base)
+  {
+    munmap(old_base, old_mapped);
+  }
+  return 0;
+}
+
+// 리스트 파일을 여는 함수 (없으면 빈 리스트로 만듦, 성공하면 0)
+// 기존 파일은 매핑만 하고 바로 사용한다. 노드를 읽거나 할당하지 않는다.
+int list_open(PersistentList *list, const char *path)
+{
+  list->base = NULL;
+  list->mapped = 0;
+  list->hdr = NULL;
+  list->fd = open(path, O_RDWR | O_CREAT, 0644);
+  if (list->fd < 0)
+  {
+    printf("파일을 열 수 없습니다: %s\n", path);
+    return -1;
+  }
+
+  struct stat st;
+  if (fstat(list->fd, &st) != 0)
+  {
+    printf("파일 정보를 읽을 수 없습니다: %s\n", path);
+    close(list->fd);
+    return -1;
+  }
+  if (st.st_size == 0)
+  {
+    // 새 파일: 헤더를 쓰고 처음 용량만큼 늘림
+    if (ftruncate(list->fd, file_bytes(INITIAL_CAPACITY)) != 0 || remap(list, file_bytes(INITIAL_CAPACITY)) != 0)
+    {
+      printf("파일을 만들 수 없습니다: %s\n", path);
+      close(list->fd);
+      return -1;
+    }
+    FileHeader *hdr = list->hdr;
+    memset(hdr, 0, sizeof(FileHeader));
+    hdr->magic = LIST_MAGIC;
+    hdr->version = LIST_VERSION;
+    hdr->node_size = sizeof(Node);
+    hdr->capacity = INITIAL_CAPACITY;
+    return 0;
+  }
+
+  if ((size_t)st.st_size < sizeof(FileHeader) || remap(list, st.st_size) != 0)
+  {
+    printf("리스트 파일이 아닙니다: %s\n", path);
+    close(list->fd);
+    return -1;
+  }
+  // 헤더만 O(1)로 검사: 깨진 파일이 첫 접근에서 매핑 밖을 가리키지 않도록 용량과 시작 오프셋을 확인
+  FileHeader *hdr = list->hdr;
+  if (hdr->magic != LIST_MAGIC || hdr->version != LIST_VERSION || hdr->node_size != sizeof(Node) ||
+      hdr->capacity == 0 || hdr->capacity > (st.st_size - sizeof(FileHeader)) / sizeof(Node) ||
+      hdr->used > hdr->capacity ||
+      !valid_offset(hdr, hdr->head) || !valid_offset(hdr, hdr->tail) || !valid_offset(hdr, hdr->free_head))
+  {
+    printf("리스트 파일 형식이 맞지 않습니다: %s\n", path);
+    munmap(list->base, list->mapped);
+    close(list->fd);
+    return -1;
+  }
+  if (hdr->dirty)
+  {
+    printf("경고: 마지막 동기화 이후 정상적으로 닫히지 않은 파일입니다.\n");
+  }
+  return 0;
+}
+
+// 마지막 list_sync 이후 첫 변경을 시작하기 전에 dirty 표시를 먼저 디스크에 기록하는 함수
+// 커널은 고친 노드 페이지를 언제든 먼저 기록할 수 있으므로, 노드를 건드리기 전에 헤더 페이지를 동기화해
+// 도중에 죽더라도 파일에 dirty가 남아 list_open이 경고하게 한다.
+void mark_dirty(PersistentList *list)
+{
+  if (!list->hdr->dirty)
+  {
+    list->hdr->dirty = 1;
+    msync(list->base, sysconf(_SC_PAGESIZE), MS_SYNC);
+  }
+}
+
+// 변경 내용을 디스크에 기록하는 함수 (내구성 보장 지점)
+// 노드를 먼저 기록한 뒤 dirty 표시를 지운 헤더를 기록한다.
+void list_sync(PersistentList *list)
+{
+  msync(list->base, list->mapped, MS_SYNC);
+  list->hdr->dirty = 0;
+  msync(list->base, sysconf(_SC_PAGESIZE), MS_SYNC);
+}
+
+// 동기화 후 매핑과 파일을 닫는 함수
+void list_close(PersistentList *list)
+{
+  list_sync(list);
+  munmap(list->base, list->mapped);
+  close(list->fd);
+  list->base = NULL;
+  list->hdr = NULL;
+}
+
+// 노드 칸을 count개 더 확보하는 함수 (파일을 두 배씩 늘린 뒤 다시 매핑, 성공하면 0)
+// 링크가 오프셋이므로 매핑 주소가 바뀌어도 고칠 것이 없다.
+int reserve(PersistentList *list, uint64_t count)
+{
+  uint64_t capacity = list->hdr->capacity;
+  if (list->hdr->used + count <= capacity)
+  {
+    return 0;
+  }
+  while (list->hdr->used + count > capacity)
+  {
+    capacity *= 2;
+  }
+  if (ftruncate(list->fd, file_bytes(capacity)) != 0 || remap(list, file_bytes(capacity)) != 0)
+  {
+    printf("파일을 늘릴 수 없습니다.\n");
+    return -1;
+  }
+  list->hdr->capacity = capacity;
+  return 0;
+}
+
+// 노드 하나를 할당하는 함수 (삭제된 노드를 먼저 재사용, 실패하면 NIL)
+uint64_t node_alloc(PersistentList *list)
+{
+  FileHeader *hdr = list->hdr;
+  if (hdr->free_head != NIL)
+  {
+    uint64_t off = hdr->free_head;
+    hdr->free_head = at(list, off)->next;
+    return off;
+  }
+  if (reserve(list, 1) != 0)
+  {
+    return NIL;
+  }
+  hdr = list->hdr; // reserve가 다시 매핑했을 수 있음
+  return slot_offset(hdr->used++);
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(PersistentList *list)
+{
+  return list->hdr->head == NIL;
+}
+
+// 리스트의 끝에 새 노드를 추가하는 함수
+void append(PersistentList *list, int data)
+{
+  mark_dirty(list);
+  uint64_t off = node_alloc(list);
+  if (off == NIL)
+  {
+    return;
+  }
+  FileHeader *hdr = list->hdr;
+  Node *new_node = at(list, off);
+  new_node->data = data;
+  new_node->next = NIL;
+  new_node->prev = hdr->tail;
+
+  if (is_empty(list))
+  {
+    hdr->head = off;
+  }
+  else
+  {
+    at(list, hdr->tail)->next = off;
+  }
+  hdr->tail = off;
+  hdr->size++;
+}
+
+// 리스트의 시작에 새 노드를 추가하는 함수
+void prepend(PersistentList *list, int data)
+{
+  mark_dirty(list);
+  uint64_t off = node_alloc(list);
+  if (off == NIL)
+  {
+    return;
+  }
+  FileHeader *hdr = list->hdr;
+  Node *new_node = at(list, off);
+  new_node->data = data;
+  new_node->next = hdr->head;
+  new_node->prev = NIL;
+
+  if (is_empty(list))
+  {
+    hdr->tail = off;
+  }
+  else
+  {
+    at(list, hdr->head)->prev = off;
+  }
+  hdr->head = off;
+  hdr->size++;
+}
+
+// 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수
+// 파일을 한 번만 늘리고, 새 노드를 파일 안에 순회 순서대로 이어서 기록한다.
+void list_append_array(PersistentList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  mark_dirty(list);
+  if (reserve(list, n) != 0)
+  {
+    return;
+  }
+  FileHeader *hdr = list->hdr;
+  uint64_t first = slot_offset(hdr->used);
+  Node *nodes = at(list, first);
+  for (size_t i = 0; i < n; i++)
+  {
+    nodes[i].data = vals[i];
+    nodes[i].next = (i + 1 < n) ? slot_offset(hdr->used + i + 1) : NIL;
+    nodes[i].prev = (i > 0) ? slot_offset(hdr->used + i - 1) : hdr->tail;
+  }
+
+  if (is_empty(list))
+  {
+    hdr->head = first;
+  }
+  else
+  {
+    at(list, hdr->tail)->next = first;
+  }
+  hdr->tail = slot_offset(hdr->used + n - 1);
+  hdr->used += n;
+  hdr->size += n;
+}
+
+// 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수 (삭제된 칸은 재사용 목록으로)
+void delete(PersistentList *list, int data)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다. 삭제할 수 없습니다.\n");
+    return;
+  }
+
+  FileHeader *hdr = list->hdr;
+  uint64_t off = hdr->head;
+  while (off != NIL && at(list, off)->data != data)
+  {
+    off = at(list, off)->next;
+  }
+  if (off == NIL)
+  {
+    printf("리스트에 해당 데이터가 없습니다.\n");
+    return;
+  }
+
+  mark_dirty(list);
+  Node *node = at(list, off);
+  if (node->prev != NIL)
+  {
+    at(list, node->prev)->next = node->next;
+  }
+  else
+  {
+    hdr->head = node->next;
+  }
+  if (node->next != NIL)
+  {
+    at(list, node->next)->prev = node->prev;
+  }
+  else
+  {
+    hdr->tail = node->prev;
+  }
+
+  node->next = hdr->free_head;
+  hdr->free_head = off;
+  hdr->size--;
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수
+int search(PersistentList *list, int data)
+{
+  for (uint64_t off = list->hdr->head; off != NIL; off = at(list, off)->next)
+  {
+    if (at(list, off)->data == data)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// 리스트의 내용을 출력하는 함수
+void show(PersistentList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  for (uint64_t off = list->hdr->head; off != NIL; off = at(list, off)->next)
+  {
+    printf("%d <-> ", at(list, off)->data);
+  }
+  printf("NULL\n");
+}
+
+// 리스트의 노드 수를 반환하는 함수
+long long length(PersistentList *list)
+{
+  return (long long)list->hdr->size;
+}
+
+// 리스트의 모든 노드를 지우는 함수 (파일 크기는 그대로 두고 모든 칸을 비움)
+void clear(PersistentList *list)
+{
+  mark_dirty(list);
+  FileHeader *hdr = list->hdr;
+  hdr->head = NIL;
+  hdr->tail = NIL;
+  hdr->free_head = NIL;
+  hdr->used = 0;
+  hdr->size = 0;
+}
+
+double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 비교용: 매번 힙에 다시 만드는 기존 방식의 노드
+typedef struct HeapNode
+{
+  int data;
+  struct HeapNode *next;
+  struct HeapNode *prev;
+} HeapNode;
+
+// 사용 예제
+int main()
+{
+  // 예제 파일은 현재 디렉터리가 아니라 $TMPDIR(없으면 /tmp) 아래에 겹치지 않는 이름으로 만든다
+  const char *tmpdir = getenv("TMPDIR");
+  char path[4096];
+  snprintf(path, sizeof(path), "%s/persistent_list_XXXXXX", tmpdir && *tmpdir ? tmpdir : "/tmp");
+  int fd = mkstemp(path);
+  if (fd < 0)
+  {
+    printf("임시 파일을 만들 수 없습니다: %s\n", path);
+    return 1;
+  }
+  close(fd); // 빈 파일이므로 list_open이 새 리스트로 초기화함
+  PersistentList list;
+
+  // 첫 실행: 파일을 만들고 노드를 추가한 뒤 닫음
+  if (list_open(&list, path) != 0)
+  {
+    unlink(path);
+    return 1;
+  }
+  append(&list, 10);
+  append(&list, 20);
+  append(&list, 30);
+  prepend(&list, 5);
+  delete (&list, 20);
+  show(&list);
+  list_close(&list);
+
+  // 재시작: 파일을 매핑하기만 하면 같은 리스트를 바로 사용
+  if (list_open(&list, path) != 0)
+  {
+    unlink(path);
+    return 1;
+  }
+  show(&list);
+  printf("10 검색: %d\n", search(&list, 10));
+  printf("리스트 길이: %lld\n", length(&list));
+
+  // 시작 시간 비교: BENCH_NODES개 리스트를 힙에 다시 만드는 것과 파일을 매핑하는 것
+  long long n = BENCH_NODES;
+  int chunk_size = 1 << 20;
+  int *chunk = (int *)malloc(chunk_size * sizeof(int));
+  clear(&list);
+  for (long long done = 0; done < n; done += chunk_size)
+  {
+    int count = (int)(n - done < chunk_size ? n - done : chunk_size);
+    for (int i = 0; i < count; i++)
+    {
+      chunk[i] = (int)(done + i);
+    }
+    list_append_array(&list, chunk, count);
+  }
+  free(chunk);
+  list_close(&list);
+
+  double start = now_seconds();
+  HeapNode *head = NULL;
+  HeapNode *tail = NULL;
+  for (long long i = 0; i < n; i++)
+  {
+    HeapNode *node = (HeapNode *)malloc(sizeof(HeapNode));
+    node->data = (int)i;
+    node->next = NULL;
+    node->prev = tail;
+    if (tail)
+    {
+      tail->next = node;
+    }
+    else
+    {
+      head = node;
+    }
+    tail = node;
+  }
+  double rebuild = now_seconds() - start;
+  while (head)
+  {
+    HeapNode *next = head->next;
+    free(head);
+    head = next;
+  }
+
+  start = now_seconds();
+  if (list_open(&list, path) != 0)
+  {
+    unlink(path);
+    return 1;
+  }
+  int last = at(&list, list.hdr->tail)->data; // 바로 마지막 노드에 접근
+  double reopen = now_seconds() - start;
+
+  printf("%lld개: 힙에 다시 만들기 %.3f초, 파일 매핑 후 사용 %.6f초 (마지막 값 %d)\n", n, rebuild, reopen, last);
+  list_close(&list);
+  unlink(path);
+  return 0;
+}
@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 
 // 단일 원형 연결 리스트의 노드를 나타내는 구조체
 typedef struct Node
@@ -8,16 +10,220 @@ typedef struct Node
   struct Node *next; // 다음 노드를 가리키는 포인터 (원형이므로 마지막 노드는 head를 가리킴)
 } Node;
 
+// 슬랩 하나에 담기는 노드 수
+#define SLAB_NODES 256
+
+// 노드 풀의 슬랩: 여러 노드를 한 번의 malloc으로 할당한 블록
+typedef struct Slab
+{
+  struct Slab *next; // 다음 슬랩
+  Node nodes[];      // 노드 배열
+} Slab;
+
+// 슬랩 그룹: 노드를 주고받은 리스트들이 함께 소유하는 슬랩 목록
+// list_split_at으로 나뉜 두 리스트는 같은 슬랩의 노드를 나눠 가지므로, 슬랩을 그룹 단위로 참조 수를 세어
+// 그룹을 쓰는 마지막 리스트가 해제될 때 한 번에 해제한다. list_concat/list_splice는 두 그룹을 O(1)에 합친다.
+typedef struct SlabGroup
+{
+  struct SlabGroup *parent;      // 다른 그룹에 합쳐졌으면 그 그룹 (대표 그룹이면 NULL)
+  struct SlabGroup *merged;      // 이 그룹에 합쳐진 그룹 목록 (대표 그룹과 함께 해제)
+  struct SlabGroup *next_merged; // merged 목록의 다음 그룹
+  Slab *slabs;                   // 할당된 슬랩 목록 (대표 그룹만 가짐)
+  Slab *last_slab;               // slabs의 마지막 슬랩, 그룹을 O(1)에 합치기 위해 유지
+  int refs;                      // 이 그룹을 쓰는 풀 수 (대표 그룹에서만 셈)
+} SlabGroup;
+
+// 노드 풀: 슬랩 그룹과 반환된 노드를 재사용하기 위한 free list
+typedef struct NodePool
+{
+  SlabGroup *group; // 슬랩을 등록하는 그룹 (처음 슬랩을 할당할 때 만듦)
+  Node *free_nodes; // 재사용 가능한 노드 목록 (next로 연결된 침습형 free list)
+  Node *free_tail;  // free list의 마지막 노드, free list를 O(1)에 넘기기 위해 유지
+} NodePool;
+
 // 단일 원형 연결 리스트를 나타내는 구조체
 typedef struct SinglyLinkedList
 {
-  Node *head; // 리스트의 시작(head)
+  Node *head;       // 리스트의 시작(head)
+  Node *tail;       // 리스트의 끝(tail), 항상 tail->next == head
+  int size;         // 노드 수, length를 O(1)로 만들기 위해 유지
+  NodePool pool;    // 노드를 할당하는 리스트 전용 노드 풀
+  Node *cursor;     // 마지막으로 get_nth로 접근한 노드 (NULL이면 없음)
+  int cursor_index; // cursor의 위치
 } SinglyLinkedList;
 
+// 리스트를 head부터 한 바퀴 O(n)에 순회하기 위한 반복자
+typedef struct ListIter
+{
+  Node *node; // 현재 노드
+  int index;  // 현재 위치
+  int size;   // 순회할 노드 수 (index가 size에 닿으면 한 바퀴 완료)
+} ListIter;
+
+// 노드 풀 초기화 함수
+void pool_init(NodePool *pool)
+{
+  pool->group = NULL;
+  pool->free_nodes = NULL;
+  pool->free_tail = NULL;
+}
+
+// 풀이 속한 대표 그룹을 반환하는 함수 (없으면 새로 만듦)
+// 합쳐진 그룹은 parent를 따라 올라가고, 다음 호출이 바로 찾도록 pool->group을 대표 그룹으로 바꿔 둔다.
+SlabGroup *pool_group(NodePool *pool)
+{
+  if (!pool->group)
+  {
+    pool->group = (SlabGroup *)calloc(1, sizeof(SlabGroup));
+    pool->group->refs = 1;
+  }
+  while (pool->group->parent)
+  {
+    pool->group = pool->group->parent;
+  }
+  return pool->group;
+}
+
+// 새 슬랩을 풀의 그룹에 등록하는 함수
+void pool_add_slab(NodePool *pool, Slab *slab)
+{
+  SlabGroup *group = pool_group(pool);
+  slab->next = group->slabs;
+  group->slabs = slab;
+  if (!group->last_slab)
+  {
+    group->last_slab = slab;
+  }
+}
+
+// 풀에서 노드 하나를 꺼내는 함수 (free list가 비면 새 슬랩을 할당)
+Node *pool_alloc(NodePool *pool)
+{
+  if (!pool->free_nodes)
+  {
+    Slab *slab = (Slab *)malloc(sizeof(Slab) + SLAB_NODES * sizeof(Node));
+    pool_add_slab(pool, slab);
+    // 슬랩의 노드들을 순서대로 free list에 연결
+    for (int i = 0; i < SLAB_NODES - 1; i++)
+    {
+      slab->nodes[i].next = &slab->nodes[i + 1];
+    }
+    slab->nodes[SLAB_NODES - 1].next = NULL;
+    pool->free_nodes = &slab->nodes[0];
+    pool->free_tail = &slab->nodes[SLAB_NODES - 1];
+  }
+
+  Node *node = pool->free_nodes;
+  pool->free_nodes = node->next;
+  return node;
+}
+
+// 노드를 풀의 free list로 반환하는 함수 (free를 호출하지 않음)
+void pool_free(NodePool *pool, Node *node)
+{
+  if (!pool->free_nodes)
+  {
+    pool->free_tail = node;
+  }
+  node->next = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+// 슬랩 하나에 노드 n개를 연속으로 할당해 반환하는 함수 (free list를 거치지 않음)
+// 다른 슬랩과 함께 pool_destroy가 한 번에 해제한다.
+Node *pool_alloc_block(NodePool *pool, size_t n)
+{
+  Slab *slab = (Slab *)malloc(sizeof(Slab) + n * sizeof(Node));
+  pool_add_slab(pool, slab);
+  return slab->nodes;
+}
+
+// 대표 그룹과 그 그룹에 합쳐진 그룹들을 슬랩과 함께 해제하는 함수 (재귀 없이 목록을 펼쳐 가며 해제)
+void group_free(SlabGroup *group)
+{
+  group->next_merged = NULL;
+  SlabGroup *pending = group;
+  while (pending)
+  {
+    SlabGroup *current = pending;
+    pending = current->next_merged;
+    for (SlabGroup *child = current->merged, *next; child; child = next)
+    {
+      next = child->next_merged;
+      child->next_merged = pending;
+      pending = child;
+    }
+
+    Slab *slab = current->slabs;
+    Slab *next;
+    while (slab)
+    {
+      next = slab->next;
+      free(slab);
+      slab = next;
+    }
+    free(current);
+  }
+}
+
+// 풀을 해제하는 함수 (그룹을 쓰는 마지막 풀이면 그룹의 모든 슬랩을 해제, 노드 수가 아니라 슬랩 수만큼만 반복)
+void pool_destroy(NodePool *pool)
+{
+  if (pool->group)
+  {
+    SlabGroup *group = pool_group(pool);
+    if (--group->refs == 0)
+    {
+      group_free(group);
+    }
+  }
+  pool_init(pool);
+}
+
+// 대표 그룹 from을 대표 그룹 into에 합치는 함수 (O(1), from의 슬랩과 참조 수가 into로 옮겨감)
+void group_union(SlabGroup *into, SlabGroup *from)
+{
+  if (into == from)
+  {
+    return;
+  }
+
+  from->parent = into;
+  into->refs += from->refs;
+  if (from->slabs)
+  {
+    from->last_slab->next = into->slabs;
+    into->slabs = from->slabs;
+    if (!into->last_slab)
+    {
+      into->last_slab = from->last_slab;
+    }
+  }
+  from->slabs = NULL;
+  from->last_slab = NULL;
+  from->next_merged = into->merged;
+  into->merged = from;
+}
+
+// dst 풀이 src 풀의 슬랩 그룹을 함께 쓰게 하는 함수 (list_split_at이 노드를 나눠 줄 때, 참조 수만 늘림)
+void pool_share(NodePool *dst, NodePool *src)
+{
+  if (src->group)
+  {
+    dst->group = pool_group(src);
+    dst->group->refs++;
+  }
+}
+
 // 리스트 초기화 함수
 void init(SinglyLinkedList *list)
 {
   list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  pool_init(&list->pool);
+  list->cursor = NULL;
+  list->cursor_index = 0;
 }
 
 // 리스트가 비어 있는지 확인하는 함수
@@ -26,10 +232,10 @@ int is_empty(SinglyLinkedList *list)
   return (list->head == NULL);
 }
 
-// 리스트의 끝에 새 노드를 추가하는 함수
-void append(SinglyLinkedList *list, int data)
+// 리스트의 끝에 새 노드를 추가하는 함수 (추가된 노드를 핸들로 반환)
+Node *append(SinglyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = NULL; // 일단 NULL로 초기화
 
@@ -38,23 +244,62 @@ void append(SinglyLinkedList *list, int data)
   {
     new_node->next = new_node; // 자기 자신을 가리킴
     list->head = new_node;
+    list->tail = new_node;
+    list->size = 1;
+    return new_node;
+  }
+
+  // 유지 중인 tail 뒤에 바로 연결 (순회 불필요)
+  list->tail->next = new_node;
+  new_node->next = list->head; // 새 노드->next가 다시 head를 가리켜 원형 구조
+  list->tail = new_node;
+  list->size++;
+  return new_node;
+}
+
+// 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수
+// n개의 노드를 연속된 블록 하나에서 순회 순서대로 꺼내므로, 이후 순회는 메모리를 순서대로 읽는다.
+void list_append_array(SinglyLinkedList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+  {
     return;
   }
 
-  // tail(마지막 노드)를 찾아서 연결
-  Node *current = list->head;
-  while (current->next != list->head) // 마지막 노드의 next는 head
+  Node *nodes = pool_alloc_block(&list->pool, n);
+  for (size_t i = 0; i + 1 < n; i++)
   {
-    current = current->next;
+    nodes[i].data = vals[i];
+    nodes[i].next = &nodes[i + 1];
   }
-  current->next = new_node;
-  new_node->next = list->head; // 새 노드->next가 다시 head를 가리켜 원형 구조
+  nodes[n - 1].data = vals[n - 1];
+
+  if (is_empty(list))
+  {
+    list->head = &nodes[0];
+  }
+  else
+  {
+    list->tail->next = &nodes[0];
+  }
+  nodes[n - 1].next = list->head; // 마지막 노드가 다시 head를 가리켜 원형 유지
+  list->tail = &nodes[n - 1];
+  list->size += (int)n;
+}
+
+// 배열로 새 리스트를 만드는 함수 (append를 n번 호출하는 대신 할당 한 번)
+SinglyLinkedList list_from_array(const int *vals, size_t n)
+{
+  SinglyLinkedList list;
+  init(&list);
+  list_append_array(&list, vals, n);
+  return list;
 }
 
 // 리스트의 시작에 새 노드를 추가하는 함수
-void prepend(SinglyLinkedList *list, int data)
+Node *prepend(SinglyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
 
   // 빈 리스트이면 append와 동일한 처리
@@ -62,19 +307,21 @@ void prepend(SinglyLinkedList *list, int data)
   {
     new_node->next = new_node; // 자기 자신 가리킴
     list->head = new_node;
-    return;
+    list->tail = new_node;
+    list->size = 1;
+    return new_node;
   }
 
-  // tail(마지막 노드)를 찾아서 새 노드를 head 앞으로 삽입
-  Node *current = list->head;
-  while (current->next != list->head)
-  {
-    current = current->next;
-  }
-  // current는 tail
+  // 유지 중인 tail을 이용해 새 노드를 head 앞으로 삽입
   new_node->next = list->head; // 새 노드는 기존 head를 가리킴
-  current->next = new_node;    // tail->next = new_node
+  list->tail->next = new_node; // tail->next = new_node
   list->head = new_node;       // head 갱신
+  list->size++;
+  if (list->cursor)
+  {
+    list->cursor_index++; // 모든 노드의 위치가 한 칸씩 밀림
+  }
+  return new_node;
 }
 
 // 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
@@ -95,8 +342,11 @@ void delete(SinglyLinkedList *list, int data)
     // 하나뿐인 노드의 data가 일치하면 삭제
     if (current->data == data)
     {
-      free(current);
+      pool_free(&list->pool, current);
       list->head = NULL;
+      list->tail = NULL;
+      list->size = 0;
+      list->cursor = NULL;
     }
     else
     {
@@ -113,22 +363,23 @@ void delete(SinglyLinkedList *list, int data)
       // 삭제 노드가 head인 경우
       if (current == list->head)
       {
-        // tail(마지막 노드)를 찾아서 tail->next를 head->next로 바꿔야 함
-        Node *tail = list->head;
-        while (tail->next != list->head)
-        {
-          tail = tail->next;
-        }
-        tail->next = list->head->next; // tail->next를 head->next로
-        list->head = list->head->next; // head를 한 칸 앞으로
-        free(current);
+        // 유지 중인 tail의 next를 head->next로 바꿔야 함
+        list->tail->next = list->head->next; // tail->next를 head->next로
+        list->head = list->head->next;       // head를 한 칸 앞으로
+        pool_free(&list->pool, current);
       }
       else
       {
         // 중간/끝 노드 삭제
         prev->next = current->next;
-        free(current);
+        if (current == list->tail)
+        {
+          list->tail = prev; // 끝 노드를 삭제하면 tail을 이전 노드로
+        }
+        pool_free(&list->pool, current);
       }
+      list->size--;
+      list->cursor = NULL; // 위치가 바뀌므로 cursor를 버림
       return;
     }
     prev = current;
@@ -203,14 +454,9 @@ void reverse(SinglyLinkedList *list)
   Node *current = list->head;
   Node *next = NULL;
 
-  // 원형을 끊기 위해 tail을 찾아서 tail->next를 NULL로 만든다.
-  Node *tail = list->head;
-  while (tail->next != list->head)
-  {
-    tail = tail->next;
-  }
-  // tail->next = NULL 로 원을 끊음
-  tail->next = NULL;
+  // 원형을 끊기 위해 tail->next를 NULL로 만든다.
+  list->tail->next = NULL;
+  list->tail = list->head; // 기존 head가 뒤집힌 후의 tail
 
   // 이제 단일 리스트처럼 뒤집기
   while (current != NULL)
@@ -224,35 +470,18 @@ void reverse(SinglyLinkedList *list)
   // prev가 새 head
   list->head = prev;
 
-  // 다시 tail을 찾아서 원형 복원 (마지막 노드->next = head)
-  tail = list->head;
-  while (tail->next != NULL)
+  // 원형 복원 (마지막 노드->next = head)
+  list->tail->next = list->head;
+  if (list->cursor)
   {
-    tail = tail->next;
+    list->cursor_index = list->size - 1 - list->cursor_index; // cursor 노드의 위치가 뒤집힘
   }
-  tail->next = list->head; // 원형 복원
 }
 
 // 리스트의 노드 수를 계산하는 함수
 int length(SinglyLinkedList *list)
 {
-  if (is_empty(list))
-  {
-    return 0;
-  }
-
-  int count = 0;
-  Node *current = list->head;
-  while (1)
-  {
-    count++;
-    current = current->next;
-    if (current == list->head)
-    {
-      break;
-    }
-  }
-  return count;
+  return list->size;
 }
 
 // 리스트의 중간 노드를 찾는 함수
@@ -276,59 +505,563 @@ int find_middle(SinglyLinkedList *list)
 }
 
 // 리스트에서 N번째 노드 데이터를 찾는 함수
+// 마지막으로 접근한 위치(cursor)를 기억해 두고, n이 그 이후면 cursor부터 이어서 이동
+// (i = 0..n-1 순서로 호출해도 전체 O(n))
 int get_nth(SinglyLinkedList *list, int n)
 {
-  if (is_empty(list))
+  if (n < 0 || n >= list->size)
   {
     printf("인덱스가 범위를 벗어났습니다.\n");
     return -1;
   }
+  if (n == list->size - 1)
+  {
+    return list->tail->data;
+  }
 
   Node *current = list->head;
   int count = 0;
-  while (1)
+  if (list->cursor && list->cursor_index <= n)
+  {
+    current = list->cursor;
+    count = list->cursor_index;
+  }
+  while (count < n)
+  {
+    current = current->next;
+    count++;
+  }
+
+  list->cursor = current;
+  list->cursor_index = n;
+  return current->data;
+}
+
+// 메모리 해제 함수 (원형을 순회하지 않고 풀의 슬랩을 통째로 해제)
+void free_list(SinglyLinkedList *list)
+{
+  pool_destroy(&list->pool);
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  list->cursor = NULL;
+  list->cursor_index = 0;
+}
+
+// 반복자를 head에 두는 함수
+ListIter list_iter_begin(SinglyLinkedList *list)
+{
+  ListIter it = {list->head, 0, list->size};
+  return it;
+}
+
+// 반복자가 한 바퀴를 다 돌았는지 확인하는 함수
+int list_iter_end(ListIter *it)
+{
+  return it->index >= it->size;
+}
+
+// 반복자를 다음 노드로 옮기는 함수
+void list_iter_next(ListIter *it)
+{
+  it->node = it->node->next;
+  it->index++;
+}
+
+// 리스트의 데이터를 앞에서부터 최대 max개까지 out 배열에 복사하는 함수 (부분 스냅샷)
+// 실제로 복사한 개수를 반환한다.
+int list_to_array_bounded(SinglyLinkedList *list, int *out, int max)
+{
+  int count = list->size < max ? list->size : max;
+  Node *current = list->head;
+  for (int i = 0; i < count; i++)
+  {
+    out[i] = current->data;
+    current = current->next;
+  }
+  return count;
+}
+
+// 리스트의 모든 데이터를 out 배열에 순서대로 복사하는 함수 (out은 length(list)개 이상)
+int list_to_array(SinglyLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+// 직렬화 형식을 확인하는 값과 형식 버전
+#define LIST_MAGIC "DSAL"
+#define LIST_FORMAT_VERSION 1
+// list_read가 한 번에 모아 list_append_array로 붙이는 데이터 수
+#define LIST_READ_CHUNK 4096
+
+// 부호 있는 차이를 작은 양수로 바꾸는 함수 (zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+uint64_t zigzag_encode(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t zigzag_decode(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// 7비트씩 나눠 기록하는 가변 길이 정수(varint)를 쓰는 함수 (작은 값일수록 짧음)
+void write_varint(FILE *fp, uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    putc((int)(v & 0x7F) | 0x80, fp);
+    v >>= 7;
+  }
+  putc((int)v, fp);
+}
+
+// varint를 읽는 함수 (성공하면 0, 파일이 끝났거나 형식이 틀리면 -1)
+int read_varint(FILE *fp, uint64_t *out)
+{
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7)
   {
-    if (count == n)
+    int c = getc(fp);
+    if (c == EOF)
     {
-      return current->data;
+      return -1;
     }
+    v |= (uint64_t)(c & 0x7F) << shift;
+    if (!(c & 0x80))
+    {
+      *out = v;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// 리스트를 이진 형식으로 기록하는 함수 (성공하면 0)
+// 형식: "DSAL" | 버전(1바이트) | 노드 수(varint) | 앞 데이터와의 차이(zigzag varint) x 노드 수
+// 노드를 하나씩 스트림에 쓰므로 리스트 크기와 관계없이 추가 메모리를 쓰지 않는다.
+int list_write(SinglyLinkedList *list, FILE *fp)
+{
+  fwrite(LIST_MAGIC, 1, 4, fp);
+  putc(LIST_FORMAT_VERSION, fp);
+  write_varint(fp, (uint64_t)list->size);
+
+  int64_t prev = 0;
+  Node *current = list->head;
+  for (int i = 0; i < list->size; i++)
+  {
+    write_varint(fp, zigzag_encode((int64_t)current->data - prev));
+    prev = current->data;
     current = current->next;
-    count++;
-    if (current == list->head)
+  }
+  return ferror(fp) ? -1 : 0;
+}
+
+// list_write로 기록한 리스트를 읽어 list의 끝에 추가하는 함수 (성공하면 0)
+// LIST_READ_CHUNK개씩 모아 list_append_array로 붙이므로 파일 전체를 메모리에 올리지 않는다.
+int list_read(SinglyLinkedList *list, FILE *fp)
+{
+  char magic[4];
+  uint64_t count;
+  if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LIST_MAGIC, 4) != 0 ||
+      getc(fp) != LIST_FORMAT_VERSION || read_varint(fp, &count) != 0)
+  {
+    printf("리스트 파일 형식이 맞지 않습니다.\n");
+    return -1;
+  }
+
+  int buffer[LIST_READ_CHUNK];
+  int filled = 0;
+  int64_t prev = 0;
+  for (uint64_t i = 0; i < count; i++)
+  {
+    uint64_t v;
+    if (read_varint(fp, &v) != 0)
+    {
+      list_append_array(list, buffer, filled); // 읽은 데까지는 붙여 둠
+      printf("리스트 파일이 중간에 끝났습니다.\n");
+      return -1;
+    }
+    prev += zigzag_decode(v);
+    buffer[filled++] = (int)prev;
+    if (filled == LIST_READ_CHUNK)
     {
-      break; // 한 바퀴 돌았는데 못 찾음 => 범위 초과
+      list_append_array(list, buffer, filled);
+      filled = 0;
     }
   }
+  list_append_array(list, buffer, filled);
+  return 0;
+}
 
-  printf("인덱스가 범위를 벗어났습니다.\n");
-  return -1;
+// 정렬된 두 노드 사슬(NULL로 끝남)을 하나로 병합하는 함수 (노드를 새로 할당하지 않고 next만 다시 연결)
+// 값이 같으면 a의 노드를 먼저 두므로 안정 정렬이 된다. 병합된 사슬의 head를 반환하고,
+// tail이 NULL이 아니면 *tail에 마지막 노드를 저장한다 (남은 쪽 사슬을 끝까지 따라가야 하므로 필요할 때만).
+Node *merge_runs(Node *a, Node *b, Node **tail)
+{
+  Node dummy;
+  Node *last = &dummy;
+  while (a && b)
+  {
+    if (b->data < a->data)
+    {
+      last->next = b;
+      b = b->next;
+    }
+    else
+    {
+      last->next = a;
+      a = a->next;
+    }
+    last = last->next;
+  }
+  last->next = a ? a : b;
+  if (tail)
+  {
+    while (last->next)
+    {
+      last = last->next;
+    }
+    *tail = last;
+  }
+  return dummy.next;
 }
 
-// 메모리 해제 함수
-void free_list(SinglyLinkedList *list)
+// 병합 정렬이 쌓아 두는 정렬된 구간의 최대 단계 수 (단계 i의 구간 길이는 2^i, int 범위의 노드 수를 모두 담음)
+#define SORT_RUN_SLOTS 32
+
+// NULL로 끝나는 노드 사슬을 정렬해 head를 반환하고 *tail에 마지막 노드를 저장하는 함수
+// 상향식 병합 정렬: 노드를 하나씩 떼어 길이 2^i인 정렬된 구간 runs[i]와 이진 카운터처럼 병합한다.
+// 추가 공간은 고정 크기 runs 배열뿐이고, 방금 병합한 구간을 바로 다시 병합하므로 캐시에 남은 노드를 다시 읽는다.
+Node *sort_chain(Node *head, Node **tail)
 {
-  if (is_empty(list))
+  Node *runs[SORT_RUN_SLOTS] = {NULL};
+  while (head)
+  {
+    Node *run = head;
+    head = head->next;
+    run->next = NULL;
+    int i = 0;
+    for (; i < SORT_RUN_SLOTS - 1 && runs[i]; i++)
+    {
+      run = merge_runs(runs[i], run, NULL); // runs[i]가 앞쪽 노드이므로 먼저 넘겨 안정성 유지
+      runs[i] = NULL;
+    }
+    runs[i] = run;
+  }
+
+  int top = SORT_RUN_SLOTS - 1;
+  while (top > 0 && !runs[top])
+  {
+    top--;
+  }
+  Node *sorted = NULL;
+  for (int i = 0; i <= top; i++)
+  {
+    if (runs[i])
+    {
+      sorted = merge_runs(runs[i], sorted, i == top ? tail : NULL); // 마지막 병합에서만 tail을 구함
+    }
+  }
+  return sorted;
+}
+
+// 리스트를 오름차순으로 정렬하는 함수 (O(n log n) 시간, O(1) 추가 공간, 안정 정렬)
+// 원형을 끊어 NULL로 끝나는 사슬로 정렬한 뒤 새 tail->next = head로 다시 잇는다.
+void list_sort(SinglyLinkedList *list)
+{
+  if (list->size < 2)
   {
     return;
   }
 
-  // 원형을 끊은 뒤 단일 리스트처럼 해제
-  Node *tail = list->head;
-  while (tail->next != list->head)
+  list->tail->next = NULL;
+  list->head = sort_chain(list->head, &list->tail);
+  list->tail->next = list->head;
+  list->cursor = NULL; // 노드의 위치가 바뀌므로 cursor를 버림
+}
+
+// src의 슬랩 그룹과 free list를 dst 풀로 옮기는 함수 (O(1), 노드는 제자리에 있고 소유권만 넘어감)
+// 이후 src 풀은 비어 있다.
+void pool_absorb(NodePool *dst, NodePool *src)
+{
+  if (src->group)
+  {
+    SlabGroup *group = pool_group(dst);
+    group_union(group, pool_group(src));
+    group->refs--; // src가 쓰던 참조를 놓음
+  }
+  if (src->free_nodes)
+  {
+    src->free_tail->next = dst->free_nodes;
+    if (!dst->free_nodes)
+    {
+      dst->free_tail = src->free_tail;
+    }
+    dst->free_nodes = src->free_nodes;
+  }
+  pool_init(src);
+}
+
+// 정렬된 리스트 b를 정렬된 리스트 a에 병합하는 함수 (O(len(a) + len(b)), 노드 할당 없음)
+// 두 원형을 끊고 병합한 뒤 다시 잇는다. b의 풀도 a가 넘겨받으므로 호출 후 b는 빈 리스트다.
+void merge_sorted(SinglyLinkedList *a, SinglyLinkedList *b)
+{
+  if (is_empty(b))
+  {
+    return;
+  }
+
+  if (!is_empty(a))
+  {
+    a->tail->next = NULL;
+  }
+  b->tail->next = NULL;
+  a->head = merge_runs(a->head, b->head, &a->tail);
+  a->tail->next = a->head;
+  a->size += b->size;
+  a->cursor = NULL;
+  pool_absorb(&a->pool, &b->pool);
+  b->head = NULL;
+  b->tail = NULL;
+  b->size = 0;
+  b->cursor = NULL;
+}
+
+// src의 모든 노드를 dst의 노드 pos 바로 뒤에 끼워 넣는 함수 (O(1), pos가 NULL이면 dst의 맨 앞)
+// 노드를 복사하지 않고 양 끝의 연결만 바꾼다. src의 노드 소유권도 dst로 넘어가므로 호출 후 src는 빈 리스트다.
+void list_splice(SinglyLinkedList *dst, Node *pos, SinglyLinkedList *src)
+{
+  if (is_empty(src))
+  {
+    return;
+  }
+
+  if (is_empty(dst))
+  {
+    dst->head = src->head;
+    dst->tail = src->tail;
+  }
+  else if (!pos)
+  {
+    src->tail->next = dst->head; // 맨 앞: tail -> src -> 기존 head
+    dst->tail->next = src->head;
+    dst->head = src->head;
+    if (dst->cursor)
+    {
+      dst->cursor_index += src->size; // 기존 노드의 위치가 src 크기만큼 밀림
+    }
+  }
+  else
+  {
+    src->tail->next = pos->next;
+    pos->next = src->head;
+    if (pos == dst->tail)
+    {
+      dst->tail = src->tail; // 끝에 이었으면 src의 tail이 새 tail (tail->next는 이미 head)
+    }
+    else
+    {
+      dst->cursor = NULL; // 중간에 끼우면 cursor 뒤쪽 위치가 바뀔 수 있으므로 cursor를 버림
+    }
+  }
+  dst->size += src->size;
+
+  pool_absorb(&dst->pool, &src->pool);
+  src->head = NULL;
+  src->tail = NULL;
+  src->size = 0;
+  src->cursor = NULL;
+}
+
+// 리스트 b를 리스트 a의 끝에 잇는 함수 (O(1), 호출 후 b는 빈 리스트)
+void list_concat(SinglyLinkedList *a, SinglyLinkedList *b)
+{
+  list_splice(a, a->tail, b);
+}
+
+// 노드 node부터 끝까지를 떼어 새 원형 리스트로 반환하는 함수 (노드를 복사하거나 옮기지 않음)
+// 단일 리스트는 node의 이전 노드를 알 수 없으므로 head부터 찾아가며 앞쪽 노드 수 k를 센다 (O(k)).
+// 두 리스트는 같은 슬랩 그룹을 함께 쓰며, 슬랩은 둘 다 해제된 뒤에 해제된다.
+SinglyLinkedList list_split_at(SinglyLinkedList *list, Node *node)
+{
+  SinglyLinkedList rest;
+  init(&rest);
+
+  int front = 0;
+  Node *prev = list->tail;
+  while (prev->next != node)
+  {
+    prev = prev->next;
+    front++;
+  }
+
+  rest.head = node;
+  rest.tail = list->tail;
+  rest.size = list->size - front;
+  rest.tail->next = rest.head;
+  if (front == 0)
+  {
+    list->head = NULL; // node가 head면 전체를 떼어 냄
+    list->tail = NULL;
+  }
+  else
+  {
+    list->tail = prev;
+    prev->next = list->head;
+  }
+  list->size = front;
+  if (list->cursor && list->cursor_index >= front)
+  {
+    list->cursor = NULL; // cursor가 떼어 낸 쪽에 있었음
+  }
+
+  pool_share(&rest.pool, &list->pool);
+  return rest;
+}
+
+// search_batch/delete_batch가 키 집합을 담는 해시 테이블의 칸
+typedef struct KeySlot
+{
+  int key;   // 키
+  int count; // keys에 나온 횟수 (0이면 빈 칸)
+  int hits;  // 순회 중 이 키와 일치해 처리한 노드 수
+} KeySlot;
+
+// 키 집합: 선형 탐사를 쓰는 개방 주소법 해시 테이블 (칸의 절반 이하만 채움)
+typedef struct KeySet
+{
+  KeySlot *slots;  // 칸 배열
+  size_t mask;     // 칸 수 - 1 (칸 수는 2의 거듭제곱)
+  size_t distinct; // 서로 다른 키 수
+} KeySet;
+
+// 키의 해시 값 (곱셈 해시 후 상위 비트를 아래로 섞음)
+size_t key_hash(int key)
+{
+  uint32_t h = (uint32_t)key * 2654435761u;
+  return h ^ (h >> 16);
+}
+
+// key가 들어 있는 칸, 없으면 key가 들어갈 빈 칸을 찾는 함수
+KeySlot *keyset_slot(KeySet *set, int key)
+{
+  size_t i = key_hash(key) & set->mask;
+  while (set->slots[i].count > 0 && set->slots[i].key != key)
+  {
+    i = (i + 1) & set->mask;
+  }
+  return &set->slots[i];
+}
+
+// keys의 k개 키를 한 번 해시해 키 집합을 만드는 함수 (O(k))
+void keyset_build(KeySet *set, const int *keys, size_t k)
+{
+  size_t capacity = 8;
+  while (capacity < 2 * k)
   {
-    tail = tail->next;
+    capacity *= 2;
   }
-  tail->next = NULL; // 원을 끊음
+  set->slots = (KeySlot *)calloc(capacity, sizeof(KeySlot));
+  set->mask = capacity - 1;
+  set->distinct = 0;
+  for (size_t i = 0; i < k; i++)
+  {
+    KeySlot *slot = keyset_slot(set, keys[i]);
+    if (slot->count == 0)
+    {
+      slot->key = keys[i];
+      set->distinct++;
+    }
+    slot->count++;
+  }
+}
 
+// 검색이 끝난 키 집합에서 keys 순서대로 결과를 채우고 집합을 해제하는 함수
+void keyset_results(KeySet *set, const int *keys, size_t k, int *results)
+{
+  for (size_t i = 0; i < k; i++)
+  {
+    results[i] = keyset_slot(set, keys[i])->hits > 0;
+  }
+  free(set->slots);
+}
+
+// keys의 k개 키가 리스트에 있는지 한 바퀴 순회로 검색해 results[i]에 1/0을 기록하는 함수 (O(k + n))
+// 키를 미리 해시해 두므로 노드마다 해시 조회 한 번으로 끝나고, 모든 키를 찾으면 순회를 멈춘다.
+void search_batch(SinglyLinkedList *list, const int *keys, size_t k, int *results)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t pending = set.distinct;
   Node *current = list->head;
-  Node *next;
-  while (current)
+  for (int i = 0; i < list->size && pending > 0; i++)
   {
-    next = current->next;
-    free(current);
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->count > 0 && slot->hits == 0)
+    {
+      slot->hits = 1;
+      pending--;
+    }
+    current = current->next;
+  }
+  keyset_results(&set, keys, k, results);
+}
+
+// keys의 각 키마다 그 값을 가진 첫 번째 노드를 한 바퀴 순회로 삭제하는 함수 (O(k + n))
+// delete를 keys 순서대로 k번 부른 것과 결과가 같다. 같은 키가 여러 번 있으면 그 수만큼 앞에서부터 삭제한다.
+// 반환값: 삭제한 노드 수
+int delete_batch(SinglyLinkedList *list, const int *keys, size_t k)
+{
+  if (is_empty(list))
+  {
+    return 0;
+  }
+
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t deleted = 0;
+  int steps = list->size; // 삭제하면서 원형이 줄어드므로 처음 노드 수만큼만 돈다
+  Node *prev = list->tail;
+  Node *current = list->head;
+  for (int i = 0; i < steps && deleted < k; i++)
+  {
+    Node *next = current->next;
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->hits < slot->count)
+    {
+      slot->hits++;
+      deleted++;
+      prev->next = next; // head를 지우면 prev가 tail이므로 tail->next도 함께 갱신됨
+      if (current == list->head)
+      {
+        list->head = next;
+      }
+      if (current == list->tail)
+      {
+        list->tail = prev;
+      }
+      pool_free(&list->pool, current);
+      list->size--;
+    }
+    else
+    {
+      prev = current;
+    }
     current = next;
   }
-  list->head = NULL;
+  free(set.slots);
+
+  if (list->size == 0)
+  {
+    list->head = NULL; // 마지막 노드를 지웠으면 head/tail이 해제된 노드를 가리킴
+    list->tail = NULL;
+  }
+  if (deleted > 0)
+  {
+    list->cursor = NULL; // 위치가 바뀌므로 cursor를 버림
+  }
+  return (int)deleted;
 }
 
 // 사용 예제
@@ -376,8 +1109,70 @@ int main()
   printf("2번째 노드: %d\n", get_nth(&sll, 2));
   // 인덱스 0=30, 1=10, 2=5 => 5
 
+  // 반복자로 전체를 O(n)에 순회
+  for (ListIter it = list_iter_begin(&sll); !list_iter_end(&it); list_iter_next(&it))
+  {
+    printf("[%d]=%d ", it.index, it.node->data);
+  }
+  printf("\n");
+
   // 메모리 해제
   free_list(&sll);
 
+  // 배열에서 한 번에 리스트 만들기 (노드가 연속된 블록 하나에 놓임)
+  int values[] = {1, 2, 3, 4, 5};
+  SinglyLinkedList bulk = list_from_array(values, 5);
+  list_append_array(&bulk, values, 2);
+  show(&bulk);
+  // 배열로 복사 (전체와 앞쪽 2개만)
+  int snapshot[8] = {0};
+  int copied = list_to_array(&bulk, snapshot);
+  printf("배열로 복사한 개수: %d, 마지막 값: %d\n", copied, snapshot[copied - 1]);
+  copied = list_to_array_bounded(&bulk, snapshot, 2);
+  printf("부분 스냅샷: %d개 [%d, %d]\n", copied, snapshot[0], snapshot[1]);
+  // 이진 형식으로 저장했다가 다시 읽기
+  FILE *fp = tmpfile();
+  list_write(&bulk, fp);
+  rewind(fp);
+  SinglyLinkedList loaded;
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  show(&loaded);
+  free_list(&loaded);
+  free_list(&bulk);
+
+  // 제자리 정렬과 정렬된 두 리스트 병합 (원형 유지)
+  int unsorted[] = {42, 7, 19, 3, 25};
+  SinglyLinkedList left = list_from_array(unsorted, 5);
+  list_sort(&left);
+  show(&left);
+  int more[] = {1, 20, 50};
+  SinglyLinkedList right = list_from_array(more, 3);
+  merge_sorted(&left, &right); // right의 노드가 left로 옮겨지고 right는 빈 리스트가 됨
+  show(&left);
+  // 핸들 위치에서 나누고, 앞뒤를 바꿔 다시 잇기 (노드 이동 없음)
+  Node *middle = left.head->next->next->next;
+  SinglyLinkedList back = list_split_at(&left, middle);
+  show(&left);
+  show(&back);
+  list_concat(&back, &left); // 나뉜 두 리스트는 같은 슬랩을 쓰므로 어느 쪽으로 이어도 됨
+  show(&back);
+  int extra[] = {100, 200};
+  SinglyLinkedList inserted = list_from_array(extra, 2);
+  list_splice(&back, back.head, &inserted); // head 바로 뒤에 통째로 끼워 넣기
+  show(&back);
+  printf("길이: %d, 끼워 넣은 리스트 길이: %d\n", length(&back), length(&inserted));
+  // 여러 키를 한 번의 순회로 검색하고 삭제
+  int batch_keys[] = {100, 7, 200, 100};
+  int batch_found[4];
+  search_batch(&back, batch_keys, 4, batch_found);
+  printf("한 번에 검색: 100=%d 7=%d 200=%d\n", batch_found[0], batch_found[1], batch_found[2]);
+  printf("한 번에 삭제한 노드 수: %d\n", delete_batch(&back, batch_keys, 4));
+  show(&back);
+  free_list(&back);
+  free_list(&inserted);
+  free_list(&left);
+
   return 0;
 }
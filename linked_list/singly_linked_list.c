@@ -1,23 +1,137 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// 점프 포인터가 가리키는 거리: 순회 중 이만큼 앞선 노드를 미리 캐시로 읽어 둔다
+#define PREFETCH_DISTANCE 16
+
+// search_many가 한 번의 순회에 함께 처리하는 키 수
+#define SEARCH_GROUP 8
+
+#if defined(__GNUC__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)(addr))
+#endif
 
 // 단일 연결 리스트의 노드를 나타내는 구조체
 typedef struct Node
 {
   int data;          // 노드에 저장된 데이터
   struct Node *next; // 다음 노드를 가리키는 포인터
+  struct Node *jump; // PREFETCH_DISTANCE개 뒤의 노드 (미리 읽기 힌트일 뿐이라 틀려도 결과는 같음)
 } Node;
 
+// 슬랩 하나에 담기는 노드 수
+#define SLAB_NODES 256
+
+// 노드 풀의 슬랩: 여러 노드를 한 번의 malloc으로 할당한 블록
+typedef struct Slab
+{
+  struct Slab *next; // 다음 슬랩
+  Node nodes[];      // 노드 배열
+} Slab;
+
+// 노드 풀: 슬랩 목록과 반환된 노드를 재사용하기 위한 free list
+typedef struct NodePool
+{
+  Slab *slabs;      // 할당된 슬랩 목록
+  Node *free_nodes; // 재사용 가능한 노드 목록 (next로 연결된 침습형 free list)
+} NodePool;
+
 // 단일 연결 리스트를 나타내는 구조체
 typedef struct SinglyLinkedList
 {
-  Node *head; // 리스트의 시작(head)
+  Node *head;       // 리스트의 시작(head)
+  Node *tail;       // 리스트의 끝(tail), append를 O(1)로 만들기 위해 유지
+  int size;         // 노드 수, length를 O(1)로 만들기 위해 유지
+  NodePool pool;    // 노드를 할당하는 리스트 전용 노드 풀
+  Node *cursor;     // 마지막으로 get_nth로 접근한 노드 (NULL이면 없음)
+  int cursor_index; // cursor의 위치
+  Node *jump_from;  // 다음에 append되는 노드를 jump로 가리켜야 할 노드 (size - PREFETCH_DISTANCE 위치, 없으면 NULL)
+  int jumps_valid;  // 모든 노드의 jump가 정확한지 여부 (0이면 search_many가 다시 계산)
 } SinglyLinkedList;
 
+// 리스트를 처음부터 끝까지 O(n)에 순회하기 위한 반복자
+typedef struct ListIter
+{
+  Node *node; // 현재 노드 (끝이면 NULL)
+  int index;  // 현재 위치
+} ListIter;
+
+// 노드 풀 초기화 함수
+void pool_init(NodePool *pool)
+{
+  pool->slabs = NULL;
+  pool->free_nodes = NULL;
+}
+
+// 풀에서 노드 하나를 꺼내는 함수 (free list가 비면 새 슬랩을 할당)
+Node *pool_alloc(NodePool *pool)
+{
+  if (!pool->free_nodes)
+  {
+    Slab *slab = (Slab *)malloc(sizeof(Slab) + SLAB_NODES * sizeof(Node));
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    // 슬랩의 노드들을 순서대로 free list에 연결
+    for (int i = 0; i < SLAB_NODES - 1; i++)
+    {
+      slab->nodes[i].next = &slab->nodes[i + 1];
+    }
+    slab->nodes[SLAB_NODES - 1].next = NULL;
+    pool->free_nodes = &slab->nodes[0];
+  }
+
+  Node *node = pool->free_nodes;
+  pool->free_nodes = node->next;
+  return node;
+}
+
+// 노드를 풀의 free list로 반환하는 함수 (free를 호출하지 않음)
+void pool_free(NodePool *pool, Node *node)
+{
+  node->next = pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+// 슬랩 하나에 노드 n개를 연속으로 할당해 반환하는 함수 (free list를 거치지 않음)
+// 다른 슬랩과 함께 pool_destroy가 한 번에 해제한다.
+Node *pool_alloc_block(NodePool *pool, size_t n)
+{
+  Slab *slab = (Slab *)malloc(sizeof(Slab) + n * sizeof(Node));
+  slab->next = pool->slabs;
+  pool->slabs = slab;
+  return slab->nodes;
+}
+
+// 풀의 모든 슬랩을 해제하는 함수 (노드 수가 아니라 슬랩 수만큼만 반복)
+void pool_destroy(NodePool *pool)
+{
+  Slab *slab = pool->slabs;
+  Slab *next;
+  while (slab)
+  {
+    next = slab->next;
+    free(slab);
+    slab = next;
+  }
+  pool_init(pool);
+}
+
 // 리스트 초기화 함수
 void init(SinglyLinkedList *list)
 {
   list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  pool_init(&list->pool);
+  list->cursor = NULL;
+  list->cursor_index = 0;
+  list->jump_from = NULL;
+  list->jumps_valid = 1;
 }
 
 // 리스트가 비어 있는지 확인하는 함수
@@ -26,34 +140,114 @@ int is_empty(SinglyLinkedList *list)
   return list->head == NULL;
 }
 
+// position 위치에 새로 붙은 끝 노드로 점프 포인터를 이어 주는 함수
+// 점프 포인터가 정확할 때만 유지하고, 아니면 search_many가 다시 계산할 때까지 내버려 둔다.
+void link_jump(SinglyLinkedList *list, Node *node, int position)
+{
+  node->jump = NULL;
+  if (!list->jumps_valid)
+  {
+    return;
+  }
+  if (position == PREFETCH_DISTANCE)
+  {
+    list->jump_from = list->head;
+  }
+  if (list->jump_from)
+  {
+    list->jump_from->jump = node;
+    list->jump_from = list->jump_from->next;
+  }
+}
+
+// 노드의 위치가 바뀌었을 때 점프 포인터를 무효로 표시하는 함수
+void invalidate_jumps(SinglyLinkedList *list)
+{
+  list->jumps_valid = 0;
+  list->jump_from = NULL;
+}
+
 // 리스트의 끝에 새 노드를 추가하는 함수
 void append(SinglyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = NULL;
 
   if (is_empty(list))
   {
     list->head = new_node;
+  }
+  else
+  {
+    list->tail->next = new_node; // tail을 유지하므로 끝까지 순회할 필요 없음
+  }
+  list->tail = new_node;
+  link_jump(list, new_node, list->size);
+  list->size++;
+}
+
+// 배열의 값들을 순서대로 리스트의 끝에 추가하는 함수
+// n개의 노드를 연속된 블록 하나에서 순회 순서대로 꺼내므로, 이후 순회는 메모리를 순서대로 읽는다.
+void list_append_array(SinglyLinkedList *list, const int *vals, size_t n)
+{
+  if (n == 0)
+  {
     return;
   }
 
-  Node *current = list->head;
-  while (current->next)
+  Node *nodes = pool_alloc_block(&list->pool, n);
+  for (size_t i = 0; i + 1 < n; i++)
   {
-    current = current->next;
+    nodes[i].data = vals[i];
+    nodes[i].next = &nodes[i + 1];
+  }
+  nodes[n - 1].data = vals[n - 1];
+  nodes[n - 1].next = NULL;
+
+  if (is_empty(list))
+  {
+    list->head = &nodes[0];
   }
-  current->next = new_node;
+  else
+  {
+    list->tail->next = &nodes[0];
+  }
+  list->tail = &nodes[n - 1];
+  for (size_t i = 0; i < n; i++)
+  {
+    link_jump(list, &nodes[i], list->size + (int)i);
+  }
+  list->size += (int)n;
+}
+
+// 배열로 새 리스트를 만드는 함수 (append를 n번 호출하는 대신 할당 한 번)
+SinglyLinkedList list_from_array(const int *vals, size_t n)
+{
+  SinglyLinkedList list;
+  init(&list);
+  list_append_array(&list, vals, n);
+  return list;
 }
 
 // 리스트의 시작에 새 노드를 추가하는 함수
 void prepend(SinglyLinkedList *list, int data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = pool_alloc(&list->pool);
   new_node->data = data;
   new_node->next = list->head;
+  new_node->jump = NULL;
   list->head = new_node;
+  if (!list->tail)
+  {
+    list->tail = new_node;
+  }
+  list->size++;
+  if (list->cursor)
+  {
+    list->cursor_index++; // 모든 노드의 위치가 한 칸씩 밀림
+  }
+  invalidate_jumps(list);
 }
 
 // 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
@@ -80,7 +274,14 @@ void delete(SinglyLinkedList *list, int data)
       {
         list->head = current->next;
       }
-      free(current);
+      if (current == list->tail)
+      {
+        list->tail = prev; // 마지막 노드를 삭제하면 tail을 이전 노드로
+      }
+      pool_free(&list->pool, current);
+      list->size--;
+      list->cursor = NULL; // 위치가 바뀌므로 cursor를 버림
+      invalidate_jumps(list);
       return;
     }
     prev = current;
@@ -129,27 +330,27 @@ void reverse(SinglyLinkedList *list)
   Node *current = list->head;
   Node *next = NULL;
 
+  list->tail = list->head; // 기존 head가 뒤집힌 후의 tail
   while (current)
   {
+    PREFETCH(current->jump); // 뒤집기 전의 점프 포인터는 순회 방향과 같은 쪽을 가리킴
     next = current->next;
     current->next = prev;
     prev = current;
     current = next;
   }
   list->head = prev;
+  if (list->cursor)
+  {
+    list->cursor_index = list->size - 1 - list->cursor_index; // cursor 노드의 위치가 뒤집힘
+  }
+  invalidate_jumps(list);
 }
 
 // 리스트의 노드 수를 계산하는 함수
 int length(SinglyLinkedList *list)
 {
-  int count = 0;
-  Node *current = list->head;
-  while (current)
-  {
-    count++;
-    current = current->next;
-  }
-  return count;
+  return list->size;
 }
 
 // 리스트의 중간 노드를 찾는 함수
@@ -167,38 +368,544 @@ int find_middle(SinglyLinkedList *list)
 }
 
 // 리스트에서 N번째 노드 데이터를 찾는 함수
+// 마지막으로 접근한 위치(cursor)를 기억해 두고, n이 그 이후면 cursor부터 이어서 이동
+// (i = 0..n-1 순서로 호출해도 전체 O(n))
 int get_nth(SinglyLinkedList *list, int n)
 {
+  if (n < 0 || n >= list->size)
+  {
+    printf("인덱스가 범위를 벗어났습니다.\n");
+    return -1;
+  }
+  if (n == list->size - 1)
+  {
+    return list->tail->data;
+  }
+
   Node *current = list->head;
   int count = 0;
+  if (list->cursor && list->cursor_index <= n)
+  {
+    current = list->cursor;
+    count = list->cursor_index;
+  }
+  while (count < n)
+  {
+    current = current->next;
+    count++;
+  }
 
-  while (current)
+  list->cursor = current;
+  list->cursor_index = n;
+  return current->data;
+}
+
+// 메모리 해제 함수 (노드를 하나씩 free하지 않고 풀의 슬랩을 통째로 해제)
+void free_list(SinglyLinkedList *list)
+{
+  pool_destroy(&list->pool);
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  list->cursor = NULL;
+  list->cursor_index = 0;
+  list->jump_from = NULL;
+  list->jumps_valid = 1;
+}
+
+// 반복자를 첫 노드에 두는 함수
+ListIter list_iter_begin(SinglyLinkedList *list)
+{
+  ListIter it = {list->head, 0};
+  return it;
+}
+
+// 반복자가 끝에 도달했는지 확인하는 함수
+int list_iter_end(ListIter *it)
+{
+  return it->node == NULL;
+}
+
+// 반복자를 다음 노드로 옮기는 함수
+void list_iter_next(ListIter *it)
+{
+  it->node = it->node->next;
+  it->index++;
+}
+
+// 리스트의 데이터를 앞에서부터 최대 max개까지 out 배열에 복사하는 함수 (부분 스냅샷)
+// 실제로 복사한 개수를 반환한다.
+int list_to_array_bounded(SinglyLinkedList *list, int *out, int max)
+{
+  int count = list->size < max ? list->size : max;
+  Node *current = list->head;
+  for (int i = 0; i < count; i++)
   {
-    if (count == n)
+    out[i] = current->data;
+    current = current->next;
+  }
+  return count;
+}
+
+// 리스트의 모든 데이터를 out 배열에 순서대로 복사하는 함수 (out은 length(list)개 이상)
+int list_to_array(SinglyLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+// 직렬화 형식을 확인하는 값과 형식 버전
+#define LIST_MAGIC "DSAL"
+#define LIST_FORMAT_VERSION 1
+// list_read가 한 번에 모아 list_append_array로 붙이는 데이터 수
+#define LIST_READ_CHUNK 4096
+
+// 부호 있는 차이를 작은 양수로 바꾸는 함수 (zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+uint64_t zigzag_encode(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+int64_t zigzag_decode(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// 7비트씩 나눠 기록하는 가변 길이 정수(varint)를 쓰는 함수 (작은 값일수록 짧음)
+void write_varint(FILE *fp, uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    putc((int)(v & 0x7F) | 0x80, fp);
+    v >>= 7;
+  }
+  putc((int)v, fp);
+}
+
+// varint를 읽는 함수 (성공하면 0, 파일이 끝났거나 형식이 틀리면 -1)
+int read_varint(FILE *fp, uint64_t *out)
+{
+  uint64_t v = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    int c = getc(fp);
+    if (c == EOF)
     {
-      return current->data;
+      return -1;
+    }
+    v |= (uint64_t)(c & 0x7F) << shift;
+    if (!(c & 0x80))
+    {
+      *out = v;
+      return 0;
     }
-    count++;
-    current = current->next;
   }
-  printf("인덱스가 범위를 벗어났습니다.\n");
   return -1;
 }
 
-// 메모리 해제 함수
-void free_list(SinglyLinkedList *list)
+// 리스트를 이진 형식으로 기록하는 함수 (성공하면 0)
+// 형식: "DSAL" | 버전(1바이트) | 노드 수(varint) | 앞 데이터와의 차이(zigzag varint) x 노드 수
+// 노드를 하나씩 스트림에 쓰므로 리스트 크기와 관계없이 추가 메모리를 쓰지 않는다.
+int list_write(SinglyLinkedList *list, FILE *fp)
 {
+  fwrite(LIST_MAGIC, 1, 4, fp);
+  putc(LIST_FORMAT_VERSION, fp);
+  write_varint(fp, (uint64_t)list->size);
+
+  int64_t prev = 0;
   Node *current = list->head;
-  Node *next;
-  while (current)
+  for (int i = 0; i < list->size; i++)
   {
-    next = current->next;
-    free(current);
+    write_varint(fp, zigzag_encode((int64_t)current->data - prev));
+    prev = current->data;
+    current = current->next;
+  }
+  return ferror(fp) ? -1 : 0;
+}
+
+// list_write로 기록한 리스트를 읽어 list의 끝에 추가하는 함수 (성공하면 0)
+// LIST_READ_CHUNK개씩 모아 list_append_array로 붙이므로 파일 전체를 메모리에 올리지 않는다.
+int list_read(SinglyLinkedList *list, FILE *fp)
+{
+  char magic[4];
+  uint64_t count;
+  if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, LIST_MAGIC, 4) != 0 ||
+      getc(fp) != LIST_FORMAT_VERSION || read_varint(fp, &count) != 0)
+  {
+    printf("리스트 파일 형식이 맞지 않습니다.\n");
+    return -1;
+  }
+
+  int buffer[LIST_READ_CHUNK];
+  int filled = 0;
+  int64_t prev = 0;
+  for (uint64_t i = 0; i < count; i++)
+  {
+    uint64_t v;
+    if (read_varint(fp, &v) != 0)
+    {
+      list_append_array(list, buffer, filled); // 읽은 데까지는 붙여 둠
+      printf("리스트 파일이 중간에 끝났습니다.\n");
+      return -1;
+    }
+    prev += zigzag_decode(v);
+    buffer[filled++] = (int)prev;
+    if (filled == LIST_READ_CHUNK)
+    {
+      list_append_array(list, buffer, filled);
+      filled = 0;
+    }
+  }
+  list_append_array(list, buffer, filled);
+  return 0;
+}
+
+// 정렬된 두 노드 사슬(NULL로 끝남)을 하나로 병합하는 함수 (노드를 새로 할당하지 않고 next만 다시 연결)
+// 값이 같으면 a의 노드를 먼저 두므로 안정 정렬이 된다. 병합된 사슬의 head를 반환하고,
+// tail이 NULL이 아니면 *tail에 마지막 노드를 저장한다 (남은 쪽 사슬을 끝까지 따라가야 하므로 필요할 때만).
+Node *merge_runs(Node *a, Node *b, Node **tail)
+{
+  Node dummy;
+  Node *last = &dummy;
+  while (a && b)
+  {
+    if (b->data < a->data)
+    {
+      last->next = b;
+      b = b->next;
+    }
+    else
+    {
+      last->next = a;
+      a = a->next;
+    }
+    last = last->next;
+  }
+  last->next = a ? a : b;
+  if (tail)
+  {
+    while (last->next)
+    {
+      last = last->next;
+    }
+    *tail = last;
+  }
+  return dummy.next;
+}
+
+// 병합 정렬이 쌓아 두는 정렬된 구간의 최대 단계 수 (단계 i의 구간 길이는 2^i, int 범위의 노드 수를 모두 담음)
+#define SORT_RUN_SLOTS 32
+
+// NULL로 끝나는 노드 사슬을 정렬해 head를 반환하고 *tail에 마지막 노드를 저장하는 함수
+// 상향식 병합 정렬: 노드를 하나씩 떼어 길이 2^i인 정렬된 구간 runs[i]와 이진 카운터처럼 병합한다.
+// 추가 공간은 고정 크기 runs 배열뿐이고, 방금 병합한 구간을 바로 다시 병합하므로 캐시에 남은 노드를 다시 읽는다.
+Node *sort_chain(Node *head, Node **tail)
+{
+  Node *runs[SORT_RUN_SLOTS] = {NULL};
+  while (head)
+  {
+    Node *run = head;
+    head = head->next;
+    run->next = NULL;
+    int i = 0;
+    for (; i < SORT_RUN_SLOTS - 1 && runs[i]; i++)
+    {
+      run = merge_runs(runs[i], run, NULL); // runs[i]가 앞쪽 노드이므로 먼저 넘겨 안정성 유지
+      runs[i] = NULL;
+    }
+    runs[i] = run;
+  }
+
+  int top = SORT_RUN_SLOTS - 1;
+  while (top > 0 && !runs[top])
+  {
+    top--;
+  }
+  Node *sorted = NULL;
+  for (int i = 0; i <= top; i++)
+  {
+    if (runs[i])
+    {
+      sorted = merge_runs(runs[i], sorted, i == top ? tail : NULL); // 마지막 병합에서만 tail을 구함
+    }
+  }
+  return sorted;
+}
+
+// 리스트를 오름차순으로 정렬하는 함수 (O(n log n) 시간, O(1) 추가 공간, 안정 정렬)
+// 기존 노드의 next만 다시 연결하므로 배열 복사나 노드 할당이 없다.
+void list_sort(SinglyLinkedList *list)
+{
+  if (list->size < 2)
+  {
+    return;
+  }
+
+  list->head = sort_chain(list->head, &list->tail);
+  list->cursor = NULL; // 노드의 위치가 바뀌므로 cursor를 버림
+  invalidate_jumps(list);
+}
+
+// src의 슬랩과 free list를 dst 풀로 옮기는 함수 (노드는 제자리에 있고 소유권만 넘어감)
+// 슬랩 수와 src의 free list 길이만큼 걸리며, 이후 src 풀은 비어 있다.
+void pool_absorb(NodePool *dst, NodePool *src)
+{
+  if (src->slabs)
+  {
+    Slab *last = src->slabs;
+    while (last->next)
+    {
+      last = last->next;
+    }
+    last->next = dst->slabs;
+    dst->slabs = src->slabs;
+  }
+  if (src->free_nodes)
+  {
+    Node *last = src->free_nodes;
+    while (last->next)
+    {
+      last = last->next;
+    }
+    last->next = dst->free_nodes;
+    dst->free_nodes = src->free_nodes;
+  }
+  pool_init(src);
+}
+
+// 정렬된 리스트 b를 정렬된 리스트 a에 병합하는 함수 (O(len(a) + len(b)), 노드 할당 없음)
+// b의 노드를 a 사이사이에 그대로 끼워 넣고 b의 풀도 a가 넘겨받으므로, 호출 후 b는 빈 리스트다.
+void merge_sorted(SinglyLinkedList *a, SinglyLinkedList *b)
+{
+  if (is_empty(b))
+  {
+    return;
+  }
+
+  a->head = merge_runs(a->head, b->head, &a->tail);
+  a->size += b->size;
+  a->cursor = NULL;
+  invalidate_jumps(a);
+  pool_absorb(&a->pool, &b->pool);
+  b->head = NULL;
+  b->tail = NULL;
+  b->size = 0;
+  b->cursor = NULL;
+  b->jump_from = NULL;
+  b->jumps_valid = 1;
+}
+
+// 모든 노드의 점프 포인터를 한 번의 순회로 다시 계산하는 함수 (O(n))
+// lead가 PREFETCH_DISTANCE만큼 앞서 가므로 trail이 쓰는 노드는 이미 캐시에 있다.
+void list_rebuild_jumps(SinglyLinkedList *list)
+{
+  Node *lead = list->head;
+  for (int i = 0; i < PREFETCH_DISTANCE && lead; i++)
+  {
+    lead = lead->next;
+  }
+  list->jump_from = NULL;
+  for (Node *trail = list->head; trail; trail = trail->next)
+  {
+    trail->jump = lead;
+    if (lead)
+    {
+      lead = lead->next;
+    }
+    else if (!list->jump_from && list->size > PREFETCH_DISTANCE)
+    {
+      list->jump_from = trail; // jump가 비어 있는 첫 노드가 다음 append를 가리킬 노드
+    }
+  }
+  list->jumps_valid = 1;
+}
+
+// keys의 n개 키를 한꺼번에 검색해 out[i]에 존재 여부(1/0)를 기록하는 함수
+// 키를 SEARCH_GROUP개씩 묶어 한 번의 순회에서 함께 비교하므로 노드 하나를 읽는 지연을 여러 검색이 나눠 쓰고,
+// 각 노드에서 점프 포인터로 PREFETCH_DISTANCE개 앞 노드를 미리 읽어 다음 노드를 기다리는 시간을 줄인다.
+void search_many(SinglyLinkedList *list, const int *keys, int n, int *out)
+{
+  if (!list->jumps_valid)
+  {
+    list_rebuild_jumps(list);
+  }
+
+  for (int base = 0; base < n; base += SEARCH_GROUP)
+  {
+    int count = n - base < SEARCH_GROUP ? n - base : SEARCH_GROUP;
+    const int *group = keys + base;
+    int *found = out + base;
+    int pending = count;
+    for (int g = 0; g < count; g++)
+    {
+      found[g] = 0;
+    }
+    for (Node *current = list->head; current && pending > 0; current = current->next)
+    {
+      PREFETCH(current->jump);
+      for (int g = 0; g < count; g++)
+      {
+        if (!found[g] && current->data == group[g])
+        {
+          found[g] = 1;
+          pending--;
+        }
+      }
+    }
+  }
+}
+
+// search_batch/delete_batch가 키 집합을 담는 해시 테이블의 칸
+typedef struct KeySlot
+{
+  int key;   // 키
+  int count; // keys에 나온 횟수 (0이면 빈 칸)
+  int hits;  // 순회 중 이 키와 일치해 처리한 노드 수
+} KeySlot;
+
+// 키 집합: 선형 탐사를 쓰는 개방 주소법 해시 테이블 (칸의 절반 이하만 채움)
+typedef struct KeySet
+{
+  KeySlot *slots;  // 칸 배열
+  size_t mask;     // 칸 수 - 1 (칸 수는 2의 거듭제곱)
+  size_t distinct; // 서로 다른 키 수
+} KeySet;
+
+// 키의 해시 값 (곱셈 해시 후 상위 비트를 아래로 섞음)
+size_t key_hash(int key)
+{
+  uint32_t h = (uint32_t)key * 2654435761u;
+  return h ^ (h >> 16);
+}
+
+// key가 들어 있는 칸, 없으면 key가 들어갈 빈 칸을 찾는 함수
+KeySlot *keyset_slot(KeySet *set, int key)
+{
+  size_t i = key_hash(key) & set->mask;
+  while (set->slots[i].count > 0 && set->slots[i].key != key)
+  {
+    i = (i + 1) & set->mask;
+  }
+  return &set->slots[i];
+}
+
+// keys의 k개 키를 한 번 해시해 키 집합을 만드는 함수 (O(k))
+void keyset_build(KeySet *set, const int *keys, size_t k)
+{
+  size_t capacity = 8;
+  while (capacity < 2 * k)
+  {
+    capacity *= 2;
+  }
+  set->slots = (KeySlot *)calloc(capacity, sizeof(KeySlot));
+  set->mask = capacity - 1;
+  set->distinct = 0;
+  for (size_t i = 0; i < k; i++)
+  {
+    KeySlot *slot = keyset_slot(set, keys[i]);
+    if (slot->count == 0)
+    {
+      slot->key = keys[i];
+      set->distinct++;
+    }
+    slot->count++;
+  }
+}
+
+// 검색이 끝난 키 집합에서 keys 순서대로 결과를 채우고 집합을 해제하는 함수
+void keyset_results(KeySet *set, const int *keys, size_t k, int *results)
+{
+  for (size_t i = 0; i < k; i++)
+  {
+    results[i] = keyset_slot(set, keys[i])->hits > 0;
+  }
+  free(set->slots);
+}
+
+// keys의 k개 키가 리스트에 있는지 한 번의 순회로 검색해 results[i]에 1/0을 기록하는 함수 (O(k + n))
+// 키를 미리 해시해 두므로 노드마다 해시 조회 한 번으로 끝나고, 모든 키를 찾으면 순회를 멈춘다.
+// 키가 몇 개뿐이면 search_many가, 수십 개 이상이면 이 함수가 유리하다.
+void search_batch(SinglyLinkedList *list, const int *keys, size_t k, int *results)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t pending = set.distinct;
+  for (Node *current = list->head; current && pending > 0; current = current->next)
+  {
+    PREFETCH(current->jump);
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->count > 0 && slot->hits == 0)
+    {
+      slot->hits = 1;
+      pending--;
+    }
+  }
+  keyset_results(&set, keys, k, results);
+}
+
+// keys의 각 키마다 그 값을 가진 첫 번째 노드를 한 번의 순회로 삭제하는 함수 (O(k + n))
+// delete를 keys 순서대로 k번 부른 것과 결과가 같다. 같은 키가 여러 번 있으면 그 수만큼 앞에서부터 삭제한다.
+// 반환값: 삭제한 노드 수
+int delete_batch(SinglyLinkedList *list, const int *keys, size_t k)
+{
+  KeySet set;
+  keyset_build(&set, keys, k);
+  size_t deleted = 0;
+  Node *prev = NULL;
+  Node *current = list->head;
+  while (current && deleted < k)
+  {
+    PREFETCH(current->jump);
+    Node *next = current->next;
+    KeySlot *slot = keyset_slot(&set, current->data);
+    if (slot->hits < slot->count)
+    {
+      slot->hits++;
+      deleted++;
+      if (prev)
+      {
+        prev->next = next;
+      }
+      else
+      {
+        list->head = next;
+      }
+      if (current == list->tail)
+      {
+        list->tail = prev;
+      }
+      pool_free(&list->pool, current);
+      list->size--;
+    }
+    else
+    {
+      prev = current;
+    }
     current = next;
   }
-  list->head = NULL;
+  free(set.slots);
+
+  if (deleted > 0)
+  {
+    list->cursor = NULL; // 위치가 바뀌므로 cursor를 버림
+    invalidate_jumps(list);
+  }
+  return (int)deleted;
 }
 
+// qsort용 int 비교 함수 (정렬 벤치마크의 비교 대상)
+int compare_int(const void *a, const void *b)
+{
+  int x = *(const int *)a;
+  int y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+// 검색 벤치마크에 쓸 노드 수 (컴파일할 때 -DBENCH_ELEMENTS=... 로 바꿀 수 있음)
+// 기본값은 노드 24바이트 기준 약 384MB로 마지막 레벨 캐시보다 훨씬 크다.
+#ifndef BENCH_ELEMENTS
+#define BENCH_ELEMENTS 16000000
+#endif
+
 // 사용 예제
 int main()
 {
@@ -219,6 +926,328 @@ int main()
   show(&sll);
   printf("중간 노드: %d\n", find_middle(&sll));
   printf("2번째 노드: %d\n", get_nth(&sll, 2));
+  // 반복자로 전체를 O(n)에 순회
+  for (ListIter it = list_iter_begin(&sll); !list_iter_end(&it); list_iter_next(&it))
+  {
+    printf("[%d]=%d ", it.index, it.node->data);
+  }
+  printf("\n");
   free_list(&sll);
+  // 배열에서 한 번에 리스트 만들기 (노드가 연속된 블록 하나에 놓임)
+  int values[] = {1, 2, 3, 4, 5};
+  SinglyLinkedList bulk = list_from_array(values, 5);
+  list_append_array(&bulk, values, 2);
+  show(&bulk);
+  // 배열로 복사 (전체와 앞쪽 2개만)
+  int snapshot[8] = {0};
+  int copied = list_to_array(&bulk, snapshot);
+  printf("배열로 복사한 개수: %d, 마지막 값: %d\n", copied, snapshot[copied - 1]);
+  copied = list_to_array_bounded(&bulk, snapshot, 2);
+  printf("부분 스냅샷: %d개 [%d, %d]\n", copied, snapshot[0], snapshot[1]);
+  // 이진 형식으로 저장했다가 다시 읽기
+  FILE *fp = tmpfile();
+  list_write(&bulk, fp);
+  rewind(fp);
+  SinglyLinkedList loaded;
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  show(&loaded);
+  free_list(&loaded);
+  free_list(&bulk);
+  // 제자리 정렬과 정렬된 두 리스트 병합
+  int unsorted[] = {42, 7, 19, 3, 25};
+  SinglyLinkedList left = list_from_array(unsorted, 5);
+  list_sort(&left);
+  show(&left);
+  int more[] = {1, 20, 50};
+  SinglyLinkedList right = list_from_array(more, 3);
+  merge_sorted(&left, &right); // right의 노드가 left로 옮겨지고 right는 빈 리스트가 됨
+  show(&left);
+  // 여러 키를 한 번에 검색
+  int keys[] = {7, 8, 42, 50};
+  int found[4];
+  search_many(&left, keys, 4, found);
+  printf("한꺼번에 검색: 7=%d 8=%d 42=%d 50=%d\n", found[0], found[1], found[2], found[3]);
+  // 키가 많으면 해시해 두고 한 번의 순회로 검색하고 삭제
+  int batch_keys[] = {50, 8, 3, 50, 20};
+  int batch_found[5];
+  search_batch(&left, batch_keys, 5, batch_found);
+  printf("한 번에 검색: 50=%d 8=%d 3=%d 20=%d\n", batch_found[0], batch_found[1], batch_found[2], batch_found[4]);
+  printf("한 번에 삭제한 노드 수: %d\n", delete_batch(&left, batch_keys, 5));
+  show(&left);
+  free_list(&left);
+
+  // 이진 형식과 텍스트(fprintf/fscanf) 왕복 처리량 비교 (int 데이터 기준 MB/s)
+  int n = 2000000;
+  SinglyLinkedList big;
+  init(&big);
+  unsigned state = 2463534242u;
+  int value = 0;
+  for (int i = 0; i < n; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    value += (int)(state % 2001) - 1000; // 이웃한 값끼리 차이가 작은 데이터
+    append(&big, value);
+  }
+  double mb = (double)n * sizeof(int) / (1024 * 1024);
+
+  clock_t start = clock();
+  fp = tmpfile();
+  list_write(&big, fp);
+  long binary_bytes = ftell(fp);
+  rewind(fp);
+  init(&loaded);
+  list_read(&loaded, fp);
+  fclose(fp);
+  double binary_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  int same = length(&loaded) == n && get_nth(&loaded, n - 1) == value;
+  free_list(&loaded);
+
+  start = clock();
+  fp = tmpfile();
+  for (Node *current = big.head; current; current = current->next)
+  {
+    fprintf(fp, "%d\n", current->data);
+  }
+  long text_bytes = ftell(fp);
+  rewind(fp);
+  init(&loaded);
+  while (fscanf(fp, "%d", &value) == 1)
+  {
+    append(&loaded, value);
+  }
+  fclose(fp);
+  double text_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  free_list(&loaded);
+  free_list(&big);
+
+  printf("%d개 왕복: 이진 %.0fMB/s (%ld바이트, 일치 %d), 텍스트 %.0fMB/s (%ld바이트)\n",
+         n, mb / binary_time, binary_bytes, same, mb / text_time, text_bytes);
+
+  // 제자리 병합 정렬과 배열로 복사 -> qsort -> 다시 만들기 비교 (무작위 데이터)
+  n = 1000000;
+  int *values_random = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    values_random[i] = (int)(state % 1000000);
+  }
+  SinglyLinkedList sorted = list_from_array(values_random, n);
+  start = clock();
+  list_sort(&sorted);
+  double sort_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  SinglyLinkedList rebuilt = list_from_array(values_random, n);
+  start = clock();
+  list_to_array(&rebuilt, values_random);
+  qsort(values_random, n, sizeof(int), compare_int);
+  free_list(&rebuilt);
+  rebuilt = list_from_array(values_random, n);
+  double rebuild_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  free(values_random);
+
+  int ordered = 1;
+  for (ListIter a = list_iter_begin(&sorted), b = list_iter_begin(&rebuilt); !list_iter_end(&a); list_iter_next(&a), list_iter_next(&b))
+  {
+    ordered &= a.node->data == b.node->data;
+  }
+  printf("%d개 정렬: 제자리 병합 정렬 %.3f초, 복사+qsort+재구성 %.3f초 (결과 일치 %d)\n",
+         n, sort_time, rebuild_time, ordered);
+  free_list(&sorted);
+  free_list(&rebuilt);
+
+  // 키 64개를 search/delete로 하나씩 처리 (O(k·n))와 search_batch/delete_batch 한 번의 순회 (O(k + n)) 비교
+  n = 1000000;
+  int batch = 64;
+  int *batch_values = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    batch_values[i] = i;
+  }
+  int *targets = (int *)malloc(batch * sizeof(int));
+  int *results = (int *)malloc(batch * sizeof(int));
+  for (int i = 0; i < batch; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    targets[i] = i * (n / batch) + (int)(state % (n / batch)); // 구간마다 하나씩 뽑아 모두 다른 값
+  }
+  SinglyLinkedList one_by_one = list_from_array(batch_values, n);
+  SinglyLinkedList batched = list_from_array(batch_values, n);
+  free(batch_values);
+
+  int search_hits = 0;
+  start = clock();
+  for (int i = 0; i < batch; i++)
+  {
+    search_hits += search(&one_by_one, targets[i]);
+  }
+  double single_search_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  start = clock();
+  search_batch(&batched, targets, batch, results);
+  double batch_search_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  for (int i = 0; i < batch; i++)
+  {
+    search_hits -= results[i];
+  }
+
+  start = clock();
+  for (int i = 0; i < batch; i++)
+  {
+    delete (&one_by_one, targets[i]);
+  }
+  double single_delete_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  start = clock();
+  int batch_deleted = delete_batch(&batched, targets, batch);
+  double batch_delete_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  printf("%d개에서 키 %d개: 검색 하나씩 %.3f초 / 한 번에 %.3f초 (차이 %d), 삭제 하나씩 %.3f초 / 한 번에 %.3f초 (%d개, 길이 %d/%d)\n",
+         n, batch, single_search_time, batch_search_time, search_hits,
+         single_delete_time, batch_delete_time, batch_deleted, length(&one_by_one), length(&batched));
+  free(targets);
+  free(results);
+  free_list(&one_by_one);
+  free_list(&batched);
+
+  // 캐시보다 훨씬 큰 리스트에서 검색 비교 (없는 키라 매번 끝까지 순회)
+  // 무작위 값을 정렬해 노드를 다시 연결하므로 리스트 순서와 메모리 순서가 어긋나 하드웨어 프리페처가 다음 노드를 예측하지 못한다.
+  n = BENCH_ELEMENTS;
+  values_random = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    values_random[i] = (int)(state % 1000000000);
+  }
+  big = list_from_array(values_random, n);
+  free(values_random);
+  list_sort(&big);
+  list_rebuild_jumps(&big);
+
+  int missing[SEARCH_GROUP];
+  for (int k = 0; k < SEARCH_GROUP; k++)
+  {
+    missing[k] = -1 - k;
+  }
+  int hits[SEARCH_GROUP];
+  start = clock();
+  int total_hits = search(&big, missing[0]);
+  double plain_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  start = clock();
+  search_many(&big, missing, 1, hits); // 미리 읽기만 적용
+  double prefetch_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  total_hits += hits[0];
+
+  start = clock();
+  search_many(&big, missing, SEARCH_GROUP, hits); // 미리 읽기 + 키 묶음
+  double grouped_time = (double)(clock() - start) / CLOCKS_PER_SEC / SEARCH_GROUP;
+  for (int k = 0; k < SEARCH_GROUP; k++)
+  {
+    total_hits += hits[k];
+  }
+
+  printf("%d개에서 키 하나당 검색: search %.3f초, 미리 읽기 %.3f초, 미리 읽기+키 %d개 묶음 %.3f초 (찾은 수 %d)\n",
+         n, plain_time, prefetch_time, SEARCH_GROUP, grouped_time, total_hits);
+  free_list(&big);
+
+  // 10M개 append: tail을 유지하므로 하나마다 O(1)
+  // 비교: tail 없이 매번 끝까지 찾아가 붙이는 방식은 O(n^2)이라 2만 개만 재고 10M개 시간을 추정한다.
+  n = 10000000;
+  SinglyLinkedList appended;
+  init(&appended);
+  start = clock();
+  for (int i = 0; i < n; i++)
+  {
+    append(&appended, i);
+  }
+  double append_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  int appended_length = length(&appended);
+  free_list(&appended);
+
+  int walk_n = 20000;
+  SinglyLinkedList walked;
+  init(&walked);
+  start = clock();
+  for (int i = 0; i < walk_n; i++)
+  {
+    Node *node = pool_alloc(&walked.pool);
+    node->data = i;
+    node->next = NULL;
+    if (!walked.head)
+    {
+      walked.head = node;
+    }
+    else
+    {
+      Node *current = walked.head;
+      while (current->next)
+      {
+        current = current->next;
+      }
+      current->next = node;
+    }
+  }
+  double walk_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+  free_list(&walked);
+  double estimate = walk_time * ((double)n / walk_n) * ((double)n / walk_n);
+  printf("%d개 append: tail 유지 %.3f초 (길이 %d), 끝까지 순회 %d개 %.3f초 -> %d개 추정 %.0f분\n",
+         n, append_time, appended_length, walk_n, walk_time, n, estimate / 60);
+
+  // 노드 할당/반환 반복 비교: 노드 풀 vs malloc/free
+  // 살아 있는 노드 4096개 중 하나를 무작위로 반환하고 새로 할당하기를 10M번 반복한다.
+  int live = 4096;
+  int churn = 10000000;
+  Node **live_nodes = (Node **)malloc(live * sizeof(Node *));
+  unsigned churn_state = 88172645u;
+  NodePool churn_pool;
+  pool_init(&churn_pool);
+  for (int i = 0; i < live; i++)
+  {
+    live_nodes[i] = pool_alloc(&churn_pool);
+  }
+  clock_t churn_start = clock();
+  for (int r = 0; r < churn; r++)
+  {
+    churn_state ^= churn_state << 13;
+    churn_state ^= churn_state >> 17;
+    churn_state ^= churn_state << 5;
+    int j = (int)(churn_state % (unsigned)live);
+    pool_free(&churn_pool, live_nodes[j]);
+    live_nodes[j] = pool_alloc(&churn_pool);
+    live_nodes[j]->data = r;
+  }
+  double pool_time = (double)(clock() - churn_start) / CLOCKS_PER_SEC;
+  pool_destroy(&churn_pool);
+
+  for (int i = 0; i < live; i++)
+  {
+    live_nodes[i] = (Node *)malloc(sizeof(Node));
+  }
+  churn_start = clock();
+  for (int r = 0; r < churn; r++)
+  {
+    churn_state ^= churn_state << 13;
+    churn_state ^= churn_state >> 17;
+    churn_state ^= churn_state << 5;
+    int j = (int)(churn_state % (unsigned)live);
+    free(live_nodes[j]);
+    live_nodes[j] = (Node *)malloc(sizeof(Node));
+    live_nodes[j]->data = r;
+  }
+  double malloc_time = (double)(clock() - churn_start) / CLOCKS_PER_SEC;
+  for (int i = 0; i < live; i++)
+  {
+    free(live_nodes[i]);
+  }
+  free(live_nodes);
+  printf("노드 할당/반환 %d번: 노드 풀 %.3f초, malloc/free %.3f초\n", churn, pool_time, malloc_time);
   return 0;
 }
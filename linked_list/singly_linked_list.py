@@ -80,6 +80,50 @@ class SinglyLinkedList:
             current = current.next
         return False
 
+    def search_batch(self, keys):
+        """
+        여러 키를 한 번의 순회로 검색 (search를 키마다 부르는 O(k·n) 대신 O(k + n)).
+        키 집합을 한 번 해시해 두고, 모든 키를 찾으면 순회를 멈춘다.
+        :param keys: 검색할 데이터 목록
+        :return: keys와 같은 순서로 각 키의 존재 여부(True/False)를 담은 리스트
+        """
+        pending = set(keys)
+        found = set()
+        current = self.head
+        while current and pending:
+            if current.data in pending:
+                pending.discard(current.data)
+                found.add(current.data)
+            current = current.next
+        return [key in found for key in keys]
+
+    def delete_batch(self, keys):
+        """
+        keys의 각 키마다 그 값을 가진 첫 번째 노드를 한 번의 순회로 삭제.
+        delete를 keys 순서대로 부른 것과 결과가 같다 (같은 키가 여러 번 있으면 그 수만큼 앞에서부터 삭제).
+        :param keys: 삭제할 데이터 목록
+        :return: 삭제한 노드 수
+        """
+        remaining = {}
+        for key in keys:
+            remaining[key] = remaining.get(key, 0) + 1
+
+        deleted = 0
+        prev = None
+        current = self.head
+        while current and deleted < len(keys):
+            if remaining.get(current.data, 0) > 0:
+                remaining[current.data] -= 1
+                deleted += 1
+                if prev:
+                    prev.next = current.next
+                else:
+                    self.head = current.next
+            else:
+                prev = current
+            current = current.next
+        return deleted
+
     def show(self):
         """
         리스트의 내용을 출력.
@@ -223,3 +267,6 @@ if __name__ == "__main__":
     sll.show()
     print("중간 노드:", sll.find_middle())
     print("2번째 노드:", sll.get_nth(2))
+    print("한 번에 검색:", sll.search_batch([10, 40, 30]))
+    print("한 번에 삭제한 노드 수:", sll.delete_batch([10, 40, 30, 10]))
+    sll.show()
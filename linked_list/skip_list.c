@@ -0,0 +1,365 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// 스킵 리스트의 최대 레벨
+#define MAX_LEVEL 32
+
+// 노드의 한 레벨: 그 레벨의 다음 노드와, 거기까지 건너뛰는 0레벨 노드 수(span)
+typedef struct Level
+{
+  struct Node *next; // 이 레벨에서 다음 노드
+  int span;          // next까지의 거리 (0레벨 기준 노드 수)
+} Level;
+
+// 스킵 리스트의 노드를 나타내는 구조체
+// level[0]만 따라가면 정렬된 단일 연결 리스트와 같다.
+typedef struct Node
+{
+  int data;       // 노드에 저장된 데이터
+  int height;     // 노드의 레벨 수
+  Level level[];  // 레벨별 다음 노드 (height개)
+} Node;
+
+// 스킵 리스트를 나타내는 구조체
+typedef struct SkipList
+{
+  Node *header;  // 데이터가 없는 시작 노드 (MAX_LEVEL개의 레벨을 가짐)
+  int level;     // 현재 사용 중인 최대 레벨
+  int size;      // 노드 수
+  unsigned seed; // 레벨을 정하는 난수 상태
+} SkipList;
+
+// 레벨 수에 맞는 노드를 할당하는 함수
+Node *create_node(int height, int data)
+{
+  Node *node = (Node *)malloc(sizeof(Node) + height * sizeof(Level));
+  node->data = data;
+  node->height = height;
+  for (int i = 0; i < height; i++)
+  {
+    node->level[i].next = NULL;
+    node->level[i].span = 0;
+  }
+  return node;
+}
+
+// 리스트 초기화 함수
+void init(SkipList *list)
+{
+  list->header = create_node(MAX_LEVEL, 0);
+  list->level = 1;
+  list->size = 0;
+  list->seed = 2463534242u;
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(SkipList *list)
+{
+  return list->size == 0;
+}
+
+// 새 노드의 레벨을 정하는 함수 (1/4 확률로 한 단계씩 올라감)
+int random_level(SkipList *list)
+{
+  int height = 1;
+  while (height < MAX_LEVEL)
+  {
+    // xorshift32 난수
+    list->seed ^= list->seed << 13;
+    list->seed ^= list->seed >> 17;
+    list->seed ^= list->seed << 5;
+    if ((list->seed & 3) != 0)
+    {
+      break;
+    }
+    height++;
+  }
+  return height;
+}
+
+// 정렬 순서를 유지하며 새 노드를 삽입하는 함수 (같은 값은 기존 값들 뒤에 삽입)
+void insert(SkipList *list, int data)
+{
+  Node *update[MAX_LEVEL]; // 레벨별로 새 노드 앞에 올 노드
+  int rank[MAX_LEVEL];     // update[i]의 위치 (header = 0)
+  Node *x = list->header;
+
+  for (int i = list->level - 1; i >= 0; i--)
+  {
+    rank[i] = (i == list->level - 1) ? 0 : rank[i + 1];
+    while (x->level[i].next && x->level[i].next->data <= data)
+    {
+      rank[i] += x->level[i].span;
+      x = x->level[i].next;
+    }
+    update[i] = x;
+  }
+
+  int height = random_level(list);
+  if (height > list->level)
+  {
+    // 새로 쓰는 레벨은 header에서 리스트 끝까지 건너뛰는 상태로 시작
+    for (int i = list->level; i < height; i++)
+    {
+      rank[i] = 0;
+      update[i] = list->header;
+      update[i]->level[i].span = list->size;
+    }
+    list->level = height;
+  }
+
+  x = create_node(height, data);
+  for (int i = 0; i < height; i++)
+  {
+    x->level[i].next = update[i]->level[i].next;
+    update[i]->level[i].next = x;
+    // 앞 노드의 span을 새 노드 기준으로 나눔
+    x->level[i].span = update[i]->level[i].span - (rank[0] - rank[i]);
+    update[i]->level[i].span = (rank[0] - rank[i]) + 1;
+  }
+
+  // 새 노드보다 높은 레벨은 새 노드를 건너뛰므로 span만 1 증가
+  for (int i = height; i < list->level; i++)
+  {
+    update[i]->level[i].span++;
+  }
+  list->size++;
+}
+
+// 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
+void delete(SkipList *list, int data)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다. 삭제할 수 없습니다.\n");
+    return;
+  }
+
+  Node *update[MAX_LEVEL];
+  Node *x = list->header;
+  for (int i = list->level - 1; i >= 0; i--)
+  {
+    while (x->level[i].next && x->level[i].next->data < data)
+    {
+      x = x->level[i].next;
+    }
+    update[i] = x;
+  }
+
+  x = x->level[0].next;
+  if (!x || x->data != data)
+  {
+    printf("리스트에 해당 데이터가 없습니다.\n");
+    return;
+  }
+
+  for (int i = 0; i < list->level; i++)
+  {
+    if (update[i]->level[i].next == x)
+    {
+      update[i]->level[i].span += x->level[i].span - 1;
+      update[i]->level[i].next = x->level[i].next;
+    }
+    else
+    {
+      update[i]->level[i].span--;
+    }
+  }
+  while (list->level > 1 && !list->header->level[list->level - 1].next)
+  {
+    list->level--;
+  }
+  free(x);
+  list->size--;
+}
+
+// data 이상인 첫 번째 노드를 찾는 함수 (없으면 NULL, 범위 순회의 시작점)
+Node *lower_bound(SkipList *list, int data)
+{
+  Node *x = list->header;
+  for (int i = list->level - 1; i >= 0; i--)
+  {
+    while (x->level[i].next && x->level[i].next->data < data)
+    {
+      x = x->level[i].next;
+    }
+  }
+  return x->level[0].next;
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수 (기대 O(log n))
+int search(SkipList *list, int data)
+{
+  Node *x = lower_bound(list, data);
+  return x && x->data == data;
+}
+
+// 0레벨만 따라가며 검색하는 함수 (단일 연결 리스트의 선형 검색과 같음, 비교용)
+int linear_search(SkipList *list, int data)
+{
+  Node *current = list->header->level[0].next;
+  while (current)
+  {
+    if (current->data == data)
+    {
+      return 1;
+    }
+    current = current->level[0].next;
+  }
+  return 0;
+}
+
+// [low, high] 범위의 데이터를 순서대로 fn에 넘기는 함수
+void for_each_in_range(SkipList *list, int low, int high, void (*fn)(int data, void *arg), void *arg)
+{
+  Node *current = lower_bound(list, low);
+  while (current && current->data <= high)
+  {
+    fn(current->data, arg);
+    current = current->level[0].next;
+  }
+}
+
+// 리스트의 내용을 출력하는 함수
+void show(SkipList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  Node *current = list->header->level[0].next;
+  while (current)
+  {
+    printf("%d -> ", current->data);
+    current = current->level[0].next;
+  }
+  printf("NULL\n");
+}
+
+// 리스트의 노드 수를 반환하는 함수
+int length(SkipList *list)
+{
+  return list->size;
+}
+
+// 리스트에서 N번째 노드 데이터를 찾는 함수 (span을 더해 가며 기대 O(log n))
+int get_nth(SkipList *list, int n)
+{
+  if (n < 0 || n >= list->size)
+  {
+    printf("인덱스가 범위를 벗어났습니다.\n");
+    return -1;
+  }
+
+  Node *x = list->header;
+  int traversed = 0; // header 이후 지나온 노드 수
+  for (int i = list->level - 1; i >= 0; i--)
+  {
+    while (x->level[i].next && traversed + x->level[i].span <= n + 1)
+    {
+      traversed += x->level[i].span;
+      x = x->level[i].next;
+    }
+    if (traversed == n + 1)
+    {
+      return x->data;
+    }
+  }
+  return -1;
+}
+
+// 리스트의 중간 노드를 찾는 함수 (단일 연결 리스트와 같은 위치인 size / 2번째)
+int find_middle(SkipList *list)
+{
+  if (is_empty(list))
+  {
+    return -1;
+  }
+  return get_nth(list, list->size / 2);
+}
+
+// 메모리 해제 함수 (header 포함)
+void free_list(SkipList *list)
+{
+  Node *current = list->header;
+  Node *next;
+  while (current)
+  {
+    next = current->level[0].next;
+    free(current);
+    current = next;
+  }
+  list->header = NULL;
+  list->level = 1;
+  list->size = 0;
+}
+
+// 범위 순회 예제에서 쓰는 출력 함수
+void print_data(int data, void *arg)
+{
+  (void)arg;
+  printf("%d ", data);
+}
+
+// 검색 비교에 쓰는 최대 노드 수 (컴파일할 때 -DBENCH_ELEMENTS=... 로 바꿀 수 있음)
+// 100만 개부터 10배씩 이 값까지 비교한다.
+#ifndef BENCH_ELEMENTS
+#define BENCH_ELEMENTS 10000000
+#endif
+
+// 사용 예제
+int main()
+{
+  SkipList sl;
+  init(&sl);
+  insert(&sl, 30);
+  insert(&sl, 10);
+  insert(&sl, 20);
+  show(&sl);
+  insert(&sl, 5);
+  show(&sl);
+  delete (&sl, 20);
+  show(&sl);
+  printf("10 검색: %d\n", search(&sl, 10));
+  printf("40 검색: %d\n", search(&sl, 40));
+  printf("리스트 길이: %d\n", length(&sl));
+  printf("중간 노드: %d\n", find_middle(&sl));
+  printf("2번째 노드: %d\n", get_nth(&sl, 2));
+  printf("[6, 30] 범위: ");
+  for_each_in_range(&sl, 6, 30, print_data, NULL);
+  printf("\n");
+  free_list(&sl);
+
+  // 100만 개부터 BENCH_ELEMENTS개까지 선형 검색과 스킵 리스트 검색 비교
+  int lookups = 200;
+  for (int n = 1000000; n <= BENCH_ELEMENTS; n *= 10)
+  {
+    init(&sl);
+    for (int i = 0; i < n; i++)
+    {
+      insert(&sl, i * 2);
+    }
+
+    int found = 0;
+    clock_t start = clock();
+    for (int i = 0; i < lookups; i++)
+    {
+      found += linear_search(&sl, (int)((long)i * 7919 % n) * 2);
+    }
+    double linear_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < lookups; i++)
+    {
+      found += search(&sl, (int)((long)i * 7919 % n) * 2);
+    }
+    double skip_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("%d개 중 %d회 검색 (찾음 %d): 선형 %.3f초, 스킵 리스트 %.6f초\n",
+           n, lookups, found, linear_time, skip_time);
+    free_list(&sl);
+  }
+  return 0;
+}
@@ -0,0 +1,889 @@
+// 컴파일: gcc -O2 -pthread unrolled_linked_list.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+// 노드 하나의 크기 (캐시 라인 2개)
+#define NODE_BYTES 128
+// 노드 하나에 담을 수 있는 데이터 수 (next 포인터와 count를 제외한 공간)
+#define NODE_CAPACITY ((NODE_BYTES - sizeof(void *) - sizeof(int)) / sizeof(int))
+
+// 언롤드 연결 리스트의 노드를 나타내는 구조체
+// 노드마다 여러 개의 데이터를 연속된 배열로 저장해 포인터 오버헤드와 캐시 미스를 줄인다.
+typedef struct Node
+{
+  struct Node *next;       // 다음 노드를 가리키는 포인터
+  int count;               // 노드에 저장된 데이터 수
+  int data[NODE_CAPACITY]; // 노드에 저장된 데이터 (앞에서부터 count개 사용)
+} Node;
+
+// 병렬 순회의 작업 단위인 구간 하나에 담기는 노드 수
+#define SEGMENT_NODES 256
+
+// 병렬 순회를 위한 구간 경계 표시: SEGMENT_NODES개 노드마다 그 구간의 첫 노드를 기록
+// 스레드마다 포인터 사슬을 처음부터 따라가지 않고 자기 구간의 첫 노드에서 바로 시작할 수 있다.
+typedef struct SegmentMarks
+{
+  Node **first; // 구간마다 첫 노드 (first[0] == head)
+  int count;    // 구간 수
+  int capacity; // first 배열 크기
+  int nodes;    // 표시한 노드 수 (append가 이어서 표시하기 위해 유지)
+  int valid;    // 0이면 다음 병렬 연산 전에 다시 만듦
+} SegmentMarks;
+
+// 언롤드 연결 리스트를 나타내는 구조체
+typedef struct UnrolledLinkedList
+{
+  Node *head;         // 리스트의 첫 노드
+  Node *tail;         // 리스트의 마지막 노드
+  int size;           // 전체 데이터 수
+  SegmentMarks marks; // 병렬 순회용 구간 경계 (append는 이어서 표시, 노드를 없애거나 앞에 붙이면 무효화)
+} UnrolledLinkedList;
+
+// 노드 하나에 연속으로 저장된 데이터 구간 (복사 없이 노드 안의 배열을 그대로 가리키는 읽기 전용 뷰)
+typedef struct Span
+{
+  const int *data; // 구간의 첫 데이터
+  int count;       // 구간의 데이터 수
+} Span;
+
+// 리스트의 데이터 구간을 앞에서부터 하나씩 꺼내는 뷰
+// 리스트를 수정하면(append, delete 등) 이전에 받은 Span과 뷰는 더 이상 유효하지 않다.
+typedef struct ListView
+{
+  const Node *node; // 다음에 꺼낼 노드
+} ListView;
+
+// 캐시 라인에 맞춰 정렬된 빈 노드를 할당하는 함수
+Node *create_node(void)
+{
+  Node *node = (Node *)aligned_alloc(64, sizeof(Node));
+  node->next = NULL;
+  node->count = 0;
+  return node;
+}
+
+// 노드 안의 데이터 배열에서 key의 위치를 찾는 함수 (스칼라 버전, 없으면 -1)
+int find_in_node_scalar(const int *data, int count, int key)
+{
+  for (int i = 0; i < count; i++)
+  {
+    if (data[i] == key)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+#ifdef HAVE_X86_SIMD
+// SSE2 버전: 4개의 int를 한 번에 비교
+__attribute__((target("sse2"))) int find_in_node_sse2(const int *data, int count, int key)
+{
+  __m128i needle = _mm_set1_epi32(key);
+  int i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)&data[i]);
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(chunk, needle)));
+    if (mask)
+    {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  int rest = find_in_node_scalar(&data[i], count - i, key);
+  return rest < 0 ? -1 : i + rest;
+}
+
+// AVX2 버전: 8개의 int를 한 번에 비교
+__attribute__((target("avx2"))) int find_in_node_avx2(const int *data, int count, int key)
+{
+  __m256i needle = _mm256_set1_epi32(key);
+  int i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)&data[i]);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, needle)));
+    if (mask)
+    {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  // 남은 4개 단위도 이 함수 안에서 VEX 인코딩으로 비교 (SSE2 함수를 부르면 AVX/SSE 전환 지연이 생김)
+  __m128i needle4 = _mm_set1_epi32(key);
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)&data[i]);
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(chunk, needle4)));
+    if (mask)
+    {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  int rest = find_in_node_scalar(&data[i], count - i, key);
+  return rest < 0 ? -1 : i + rest;
+}
+#endif
+
+int find_in_node_resolve(const int *data, int count, int key);
+
+// 현재 CPU에 맞는 노드 검색 함수 (첫 호출 때 CPUID로 결정)
+int (*find_in_node)(const int *data, int count, int key) = find_in_node_resolve;
+
+// CPUID로 AVX2/SSE2 지원 여부를 확인해 find_in_node를 교체한 뒤 검색하는 함수
+int find_in_node_resolve(const int *data, int count, int key)
+{
+  find_in_node = find_in_node_scalar;
+#ifdef HAVE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+  {
+    find_in_node = find_in_node_avx2;
+  }
+  else if (__builtin_cpu_supports("sse2"))
+  {
+    find_in_node = find_in_node_sse2;
+  }
+#endif
+  return find_in_node(data, count, key);
+}
+
+// 리스트 초기화 함수
+void init(UnrolledLinkedList *list)
+{
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  list->marks.first = NULL;
+  list->marks.count = 0;
+  list->marks.capacity = 0;
+  list->marks.nodes = 0;
+  list->marks.valid = 1; // 빈 리스트는 구간 0개로 이미 표시된 상태
+}
+
+// 구간 경계 목록의 끝에 구간의 첫 노드를 추가하는 함수
+void marks_push(SegmentMarks *marks, Node *node)
+{
+  if (marks->count == marks->capacity)
+  {
+    marks->capacity = marks->capacity ? marks->capacity * 2 : 64;
+    marks->first = (Node **)realloc(marks->first, marks->capacity * sizeof(Node *));
+  }
+  marks->first[marks->count++] = node;
+}
+
+// 새로 붙은 노드를 구간 경계에 반영하는 함수 (SEGMENT_NODES개째마다 새 구간 시작)
+void marks_note_append(SegmentMarks *marks, Node *node)
+{
+  if (!marks->valid)
+  {
+    return;
+  }
+  if (marks->nodes % SEGMENT_NODES == 0)
+  {
+    marks_push(marks, node);
+  }
+  marks->nodes++;
+}
+
+// 노드를 한 번 따라가며 구간 경계를 다시 표시하는 함수 (O(노드 수))
+void marks_rebuild(UnrolledLinkedList *list)
+{
+  list->marks.count = 0;
+  list->marks.nodes = 0;
+  list->marks.valid = 1;
+  for (Node *current = list->head; current; current = current->next)
+  {
+    marks_note_append(&list->marks, current);
+  }
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(UnrolledLinkedList *list)
+{
+  return list->head == NULL;
+}
+
+// 리스트의 끝에 새 데이터를 추가하는 함수
+void append(UnrolledLinkedList *list, int data)
+{
+  // 마지막 노드가 가득 찼을 때만 새 노드를 만든다
+  if (is_empty(list) || list->tail->count == (int)NODE_CAPACITY)
+  {
+    Node *new_node = create_node();
+    if (is_empty(list))
+    {
+      list->head = new_node;
+    }
+    else
+    {
+      list->tail->next = new_node;
+    }
+    list->tail = new_node;
+    marks_note_append(&list->marks, new_node);
+  }
+
+  list->tail->data[list->tail->count++] = data;
+  list->size++;
+}
+
+// 리스트의 시작에 새 데이터를 추가하는 함수
+void prepend(UnrolledLinkedList *list, int data)
+{
+  // 첫 노드가 가득 찼으면 앞에 새 노드를 만든다
+  if (is_empty(list) || list->head->count == (int)NODE_CAPACITY)
+  {
+    Node *new_node = create_node();
+    new_node->next = list->head;
+    list->head = new_node;
+    if (!list->tail)
+    {
+      list->tail = new_node;
+    }
+    list->marks.valid = 0; // 모든 구간의 첫 노드가 한 칸씩 밀림
+  }
+
+  // 노드 안의 데이터를 한 칸씩 밀고 맨 앞에 삽입
+  Node *head = list->head;
+  memmove(&head->data[1], &head->data[0], head->count * sizeof(int));
+  head->data[0] = data;
+  head->count++;
+  list->size++;
+}
+
+// 지정된 데이터를 가진 첫 번째 데이터를 삭제하는 함수
+void delete(UnrolledLinkedList *list, int data)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다. 삭제할 수 없습니다.\n");
+    return;
+  }
+
+  Node *current = list->head;
+  Node *prev = NULL;
+
+  while (current)
+  {
+    int i = find_in_node(current->data, current->count, data);
+    if (i >= 0)
+    {
+      // 노드 안에서 뒤쪽 데이터를 당겨 빈 칸을 메움
+      memmove(&current->data[i], &current->data[i + 1], (current->count - i - 1) * sizeof(int));
+      current->count--;
+      list->size--;
+
+      if (current->count == 0)
+      {
+        // 노드가 비었으면 리스트에서 제거
+        if (prev)
+        {
+          prev->next = current->next;
+        }
+        else
+        {
+          list->head = current->next;
+        }
+        if (current == list->tail)
+        {
+          list->tail = prev;
+        }
+        free(current);
+        list->marks.valid = 0; // 구간의 첫 노드였을 수 있음
+      }
+      else if (current->next && current->count + current->next->count <= (int)NODE_CAPACITY)
+      {
+        // 다음 노드와 합쳐도 넘치지 않으면 병합해 노드 밀도를 유지
+        Node *next = current->next;
+        memcpy(&current->data[current->count], next->data, next->count * sizeof(int));
+        current->count += next->count;
+        current->next = next->next;
+        if (next == list->tail)
+        {
+          list->tail = current;
+        }
+        free(next);
+        list->marks.valid = 0;
+      }
+      return;
+    }
+    prev = current;
+    current = current->next;
+  }
+  printf("리스트에 해당 데이터가 없습니다.\n");
+}
+
+// 지정된 데이터를 검색하는 함수
+int search(UnrolledLinkedList *list, int data)
+{
+  Node *current = list->head;
+  while (current)
+  {
+    // 노드 안의 데이터는 연속된 배열이므로 SIMD로 여러 개를 한 번에 비교
+    if (find_in_node(current->data, current->count, data) >= 0)
+    {
+      return 1; // 데이터가 존재함
+    }
+    current = current->next;
+  }
+  return 0; // 데이터가 없음
+}
+
+// 리스트의 내용을 출력하는 함수 (노드 경계는 [ ]로 표시)
+void show(UnrolledLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  Node *current = list->head;
+  while (current)
+  {
+    printf("[");
+    for (int i = 0; i < current->count; i++)
+    {
+      printf(i ? " %d" : "%d", current->data[i]);
+    }
+    printf("] -> ");
+    current = current->next;
+  }
+  printf("NULL\n");
+}
+
+// 리스트를 뒤집는 함수 (노드 순서와 각 노드 안의 데이터 순서를 모두 뒤집음)
+void reverse(UnrolledLinkedList *list)
+{
+  Node *prev = NULL;
+  Node *current = list->head;
+  Node *next = NULL;
+
+  list->tail = list->head;
+  while (current)
+  {
+    for (int i = 0, j = current->count - 1; i < j; i++, j--)
+    {
+      int temp = current->data[i];
+      current->data[i] = current->data[j];
+      current->data[j] = temp;
+    }
+    next = current->next;
+    current->next = prev;
+    prev = current;
+    current = next;
+  }
+  list->head = prev;
+  list->marks.valid = 0; // 노드 순서가 뒤집힘
+}
+
+// 리스트의 데이터 수를 반환하는 함수
+int length(UnrolledLinkedList *list)
+{
+  return list->size;
+}
+
+// 리스트에서 N번째 데이터를 찾는 함수 (노드 단위로 count만큼 건너뜀)
+int get_nth(UnrolledLinkedList *list, int n)
+{
+  Node *current = list->head;
+
+  if (n >= 0)
+  {
+    while (current)
+    {
+      if (n < current->count)
+      {
+        return current->data[n];
+      }
+      n -= current->count;
+      current = current->next;
+    }
+  }
+  printf("인덱스가 범위를 벗어났습니다.\n");
+  return -1;
+}
+
+// 리스트의 중간 데이터를 찾는 함수 (단일 연결 리스트와 같은 위치인 size / 2번째)
+int find_middle(UnrolledLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    return -1;
+  }
+  return get_nth(list, list->size / 2);
+}
+
+// 메모리 해제 함수
+void free_list(UnrolledLinkedList *list)
+{
+  Node *current = list->head;
+  Node *next;
+  while (current)
+  {
+    next = current->next;
+    free(current);
+    current = next;
+  }
+  free(list->marks.first);
+  init(list);
+}
+
+// 리스트의 데이터를 앞에서부터 최대 max개까지 out 배열에 복사하는 함수 (부분 스냅샷)
+// 노드 단위로 memcpy하므로 데이터 하나씩 따라가는 것보다 빠르다. 실제로 복사한 개수를 반환한다.
+int list_to_array_bounded(UnrolledLinkedList *list, int *out, int max)
+{
+  int copied = 0;
+  for (Node *current = list->head; current && copied < max; current = current->next)
+  {
+    int n = current->count < max - copied ? current->count : max - copied;
+    memcpy(out + copied, current->data, n * sizeof(int));
+    copied += n;
+  }
+  return copied;
+}
+
+// 리스트의 모든 데이터를 out 배열에 순서대로 복사하는 함수 (out은 length(list)개 이상)
+int list_to_array(UnrolledLinkedList *list, int *out)
+{
+  return list_to_array_bounded(list, out, list->size);
+}
+
+// 데이터 구간 뷰를 리스트의 처음에 두는 함수
+ListView list_view_begin(UnrolledLinkedList *list)
+{
+  ListView view = {list->head};
+  return view;
+}
+
+// 다음 데이터 구간을 span에 담는 함수 (더 이상 없으면 0)
+int list_view_next(ListView *view, Span *span)
+{
+  // 빈 노드는 건너뜀
+  while (view->node && view->node->count == 0)
+  {
+    view->node = view->node->next;
+  }
+  if (!view->node)
+  {
+    return 0;
+  }
+  span->data = view->node->data;
+  span->count = view->node->count;
+  view->node = view->node->next;
+  return 1;
+}
+
+// 병렬 연산에 참여하는 최대 스레드 수
+#define MAX_WORKERS 64
+
+// list_reduce가 데이터를 누적하고 구간별 결과를 합치는 데 쓰는 함수 (결합 법칙을 만족해야 함)
+typedef long long (*ReduceFn)(long long acc, long long value);
+
+// 작업자 하나가 맡은 구간 번호 범위 [lo, hi)를 64비트 하나에 묶은 덱
+// 주인은 앞(lo)에서 하나씩 가져가고, 일이 떨어진 다른 작업자는 뒤(hi)에서 절반을 훔친다.
+// 양쪽 모두 CAS 한 번으로 가져가므로 락이 필요 없다.
+typedef struct WorkRange
+{
+  _Atomic uint64_t bounds; // lo << 32 | hi
+  char pad[56];            // 작업자마다 다른 캐시 라인을 쓰도록 채움 (false sharing 방지)
+} WorkRange;
+
+// 병렬 연산 한 번의 공유 상태
+typedef struct ParallelJob
+{
+  SegmentMarks *marks;
+  int workers;
+  WorkRange ranges[MAX_WORKERS];
+  ReduceFn fn;        // list_reduce: 누적 함수
+  long long init;     // list_reduce: 항등원
+  long long *results; // list_reduce: 구간별 결과 (구간 순서대로 합쳐 순서를 보존)
+  int key;            // list_find_any: 찾을 데이터
+  atomic_int found;   // list_find_any: 찾았으면 1 (다른 작업자도 보고 멈춤)
+} ParallelJob;
+
+// 작업자 스레드에 넘기는 인자
+typedef struct WorkerArg
+{
+  ParallelJob *job;
+  int id;
+  int find; // 1이면 list_find_any, 0이면 list_reduce
+} WorkerArg;
+
+uint64_t pack_range(uint32_t lo, uint32_t hi)
+{
+  return (uint64_t)lo << 32 | hi;
+}
+
+// 자기 덱의 앞에서 구간 하나를 가져오는 함수 (없으면 0)
+int take_own(WorkRange *range, int *segment)
+{
+  uint64_t bounds = atomic_load(&range->bounds);
+  while ((uint32_t)(bounds >> 32) < (uint32_t)bounds)
+  {
+    uint32_t lo = (uint32_t)(bounds >> 32);
+    if (atomic_compare_exchange_weak(&range->bounds, &bounds, pack_range(lo + 1, (uint32_t)bounds)))
+    {
+      *segment = (int)lo;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// 다른 작업자의 덱 뒤쪽 절반을 훔쳐 하나는 바로 처리하고 나머지는 자기 덱에 넣는 함수 (모두 비었으면 0)
+int steal(ParallelJob *job, int self, int *segment)
+{
+  for (int k = 1; k < job->workers; k++)
+  {
+    WorkRange *victim = &job->ranges[(self + k) % job->workers];
+    uint64_t bounds = atomic_load(&victim->bounds);
+    while ((uint32_t)(bounds >> 32) < (uint32_t)bounds)
+    {
+      uint32_t lo = (uint32_t)(bounds >> 32);
+      uint32_t hi = (uint32_t)bounds;
+      uint32_t mid = hi - (hi - lo + 1) / 2;
+      if (atomic_compare_exchange_weak(&victim->bounds, &bounds, pack_range(lo, mid)))
+      {
+        *segment = (int)mid;
+        atomic_store(&job->ranges[self].bounds, pack_range(mid + 1, hi)); // 자기 덱은 비어 있었으므로 그대로 덮어씀
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// 구간 하나를 처리하는 함수 (구간은 first[segment]부터 다음 구간의 첫 노드 전까지)
+void run_segment(ParallelJob *job, int segment, int find)
+{
+  const Node *end = segment + 1 < job->marks->count ? job->marks->first[segment + 1] : NULL;
+  if (find)
+  {
+    for (const Node *current = job->marks->first[segment]; current != end; current = current->next)
+    {
+      if (atomic_load_explicit(&job->found, memory_order_relaxed))
+      {
+        return; // 다른 작업자가 이미 찾음
+      }
+      if (find_in_node(current->data, current->count, job->key) >= 0)
+      {
+        atomic_store(&job->found, 1);
+        return;
+      }
+    }
+    return;
+  }
+
+  long long acc = job->init;
+  for (const Node *current = job->marks->first[segment]; current != end; current = current->next)
+  {
+    for (int i = 0; i < current->count; i++)
+    {
+      acc = job->fn(acc, current->data[i]);
+    }
+  }
+  job->results[segment] = acc;
+}
+
+// 작업자 스레드: 자기 덱이 비면 다른 작업자의 덱에서 훔치고, 모든 덱이 비면 끝낸다.
+void *worker_main(void *arg)
+{
+  WorkerArg *worker = (WorkerArg *)arg;
+  ParallelJob *job = worker->job;
+  int segment;
+  while (take_own(&job->ranges[worker->id], &segment) || steal(job, worker->id, &segment))
+  {
+    run_segment(job, segment, worker->find);
+    if (worker->find && atomic_load(&job->found))
+    {
+      break;
+    }
+  }
+  return NULL;
+}
+
+// 구간들을 작업자 수만큼 고르게 나눠 각 덱에 넣고, 호출한 스레드를 포함해 workers개 스레드로 처리하는 함수
+void run_parallel(ParallelJob *job, int nthreads, int find)
+{
+  int workers = nthreads < 1 ? 1 : nthreads;
+  if (workers > MAX_WORKERS)
+  {
+    workers = MAX_WORKERS;
+  }
+  if (workers > job->marks->count)
+  {
+    workers = job->marks->count > 0 ? job->marks->count : 1;
+  }
+  job->workers = workers;
+  for (int w = 0; w < workers; w++)
+  {
+    long long lo = (long long)job->marks->count * w / workers;
+    long long hi = (long long)job->marks->count * (w + 1) / workers;
+    atomic_init(&job->ranges[w].bounds, pack_range((uint32_t)lo, (uint32_t)hi));
+  }
+
+  pthread_t threads[MAX_WORKERS];
+  WorkerArg args[MAX_WORKERS];
+  for (int w = 0; w < workers; w++)
+  {
+    args[w].job = job;
+    args[w].id = w;
+    args[w].find = find;
+    if (w > 0)
+    {
+      pthread_create(&threads[w], NULL, worker_main, &args[w]);
+    }
+  }
+  worker_main(&args[0]);
+  for (int w = 1; w < workers; w++)
+  {
+    pthread_join(threads[w], NULL);
+  }
+}
+
+// 리스트의 모든 데이터를 fn으로 접어 하나의 값을 구하는 함수 (nthreads개 스레드로 병렬 처리)
+// 구간마다 init에서 시작해 따로 접은 뒤 구간 순서대로 합치므로, fn은 결합 법칙을 만족하고 init은 항등원이어야 한다.
+// (합: 0과 덧셈, 최솟값: LLONG_MAX와 min 등) 순회 중에는 리스트를 수정하면 안 된다.
+long long list_reduce(UnrolledLinkedList *list, ReduceFn fn, long long init, int nthreads)
+{
+  if (!list->marks.valid)
+  {
+    marks_rebuild(list);
+  }
+
+  ParallelJob job;
+  job.marks = &list->marks;
+  job.fn = fn;
+  job.init = init;
+  job.results = (long long *)malloc((list->marks.count + 1) * sizeof(long long));
+  run_parallel(&job, nthreads, 0);
+
+  long long acc = init;
+  for (int i = 0; i < list->marks.count; i++)
+  {
+    acc = fn(acc, job.results[i]);
+  }
+  free(job.results);
+  return acc;
+}
+
+// 데이터가 리스트에 있는지 nthreads개 스레드로 나눠 찾는 함수 (있으면 1)
+// 어느 구간이든 먼저 찾으면 다른 작업자도 노드 하나를 마칠 때 멈춘다.
+int list_find_any(UnrolledLinkedList *list, int data, int nthreads)
+{
+  if (!list->marks.valid)
+  {
+    marks_rebuild(list);
+  }
+  find_in_node(NULL, 0, data); // 작업자를 띄우기 전에 CPU에 맞는 검색 함수를 결정해 둠
+
+  ParallelJob job;
+  job.marks = &list->marks;
+  job.key = data;
+  atomic_init(&job.found, 0);
+  run_parallel(&job, nthreads, 1);
+  return atomic_load(&job.found);
+}
+
+long long reduce_sum(long long acc, long long value)
+{
+  return acc + value;
+}
+
+long long reduce_max(long long acc, long long value)
+{
+  return value > acc ? value : acc;
+}
+
+// 비교용: 데이터 하나마다 노드 하나를 malloc하는 단일 연결 리스트의 노드
+typedef struct ChainNode
+{
+  int data;
+  struct ChainNode *next;
+} ChainNode;
+
+// 벤치마크에 쓸 데이터 수 (컴파일할 때 -DBENCH_ELEMENTS=... 로 바꿀 수 있음)
+#ifndef BENCH_ELEMENTS
+#define BENCH_ELEMENTS 100000000
+#endif
+
+// 사용 예제
+int main()
+{
+  UnrolledLinkedList ull;
+  init(&ull);
+  for (int i = 1; i <= 40; i++)
+  {
+    append(&ull, i * 10);
+  }
+  show(&ull);
+  prepend(&ull, 5);
+  show(&ull);
+  delete (&ull, 20);
+  show(&ull);
+  printf("10 검색: %d\n", search(&ull, 10));
+  printf("20 검색: %d\n", search(&ull, 20));
+  printf("리스트 길이: %d\n", length(&ull));
+  reverse(&ull);
+  show(&ull);
+  printf("중간 노드: %d\n", find_middle(&ull));
+  printf("2번째 노드: %d\n", get_nth(&ull, 2));
+  printf("노드당 데이터 수: %d, 데이터당 메모리: %.2f바이트\n",
+         (int)NODE_CAPACITY, (double)sizeof(Node) / NODE_CAPACITY);
+
+  // 배열로 복사하지 않고 노드 안의 데이터 구간을 그대로 읽어 합계 구하기
+  long sum = 0;
+  int spans = 0;
+  ListView view = list_view_begin(&ull);
+  Span span;
+  while (list_view_next(&view, &span))
+  {
+    for (int i = 0; i < span.count; i++)
+    {
+      sum += span.data[i];
+    }
+    spans++;
+  }
+  printf("구간 %d개, 합계: %ld\n", spans, sum);
+
+  int snapshot[8] = {0};
+  int copied = list_to_array_bounded(&ull, snapshot, 8);
+  printf("앞쪽 %d개 스냅샷: %d ... %d\n", copied, snapshot[0], snapshot[copied - 1]);
+  // 여러 스레드로 나눠 합계/최댓값 구하기와 검색
+  printf("병렬 합계: %lld, 최댓값: %lld, 400 검색: %d\n",
+         list_reduce(&ull, reduce_sum, 0, 4), list_reduce(&ull, reduce_max, LLONG_MIN, 4), list_find_any(&ull, 400, 4));
+  free_list(&ull);
+
+  // 같은 데이터 수의 단일 연결 리스트와 전체 검색(없는 값) 처리량 비교
+  int chain_n = 10000000;
+  int scans = 5;
+  init(&ull);
+  ChainNode *chain_head = NULL;
+  ChainNode *chain_tail = NULL;
+  for (int i = 0; i < chain_n; i++)
+  {
+    append(&ull, i);
+  }
+  for (int i = 0; i < chain_n; i++)
+  {
+    ChainNode *node = (ChainNode *)malloc(sizeof(ChainNode));
+    node->data = i;
+    node->next = NULL;
+    if (chain_tail)
+    {
+      chain_tail->next = node;
+    }
+    else
+    {
+      chain_head = node;
+    }
+    chain_tail = node;
+  }
+  int scan_hits = 0;
+  clock_t scan_start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    scan_hits += search(&ull, -1);
+  }
+  double unrolled_scan = (double)(clock() - scan_start) / CLOCKS_PER_SEC / scans;
+  scan_start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    for (ChainNode *current = chain_head; current; current = current->next)
+    {
+      if (current->data == -1)
+      {
+        scan_hits++;
+        break;
+      }
+    }
+  }
+  double chain_scan = (double)(clock() - scan_start) / CLOCKS_PER_SEC / scans;
+  double mb = (double)chain_n * sizeof(int) / (1024 * 1024);
+  printf("%d개 전체 검색: 언롤드 %.4f초 (%.0fMB/s), 단일 연결 %.4f초 (%.0fMB/s) (찾은 수 %d)\n",
+         chain_n, unrolled_scan, mb / unrolled_scan, chain_scan, mb / chain_scan, scan_hits);
+  free_list(&ull);
+  while (chain_head)
+  {
+    ChainNode *next = chain_head->next;
+    free(chain_head);
+    chain_head = next;
+  }
+
+  // 크기별 search 시간: 스칼라 / SSE2 / AVX2 노드 검색 비교 (1K부터 BENCH_ELEMENTS개까지 10배씩)
+  // 없는 값을 찾아 매번 전체를 순회하고, 크기마다 BENCH_ELEMENTS / n번 반복해 비교하는 데이터 총량을 맞춘다.
+  int (*impls[3])(const int *, int, int) = {find_in_node_scalar, NULL, NULL};
+#ifdef HAVE_X86_SIMD
+  __builtin_cpu_init();
+  impls[1] = find_in_node_sse2;
+  if (__builtin_cpu_supports("avx2"))
+  {
+    impls[2] = find_in_node_avx2;
+  }
+#endif
+  init(&ull);
+  int filled = 0;
+  for (long long n = 1000; n <= BENCH_ELEMENTS; n *= 10)
+  {
+    for (; filled < n; filled++)
+    {
+      append(&ull, filled % 1000);
+    }
+    int repeat = (int)(BENCH_ELEMENTS / n);
+    double times[3] = {-1, -1, -1}; // 지원하지 않는 버전은 -1
+    int hits = 0;
+    for (int v = 0; v < 3; v++)
+    {
+      if (!impls[v])
+      {
+        continue;
+      }
+      find_in_node = impls[v];
+      clock_t start = clock();
+      for (int r = 0; r < repeat; r++)
+      {
+        hits += search(&ull, -1);
+      }
+      times[v] = (double)(clock() - start) / CLOCKS_PER_SEC;
+    }
+    printf("%lld개 x %d번 검색: 스칼라 %.3f초, SSE2 %.3f초, AVX2 %.3f초 (찾은 수 %d)\n",
+           n, repeat, times[0], times[1], times[2], hits);
+  }
+  find_in_node = find_in_node_resolve;
+  free_list(&ull);
+
+  // 스레드 수에 따른 병렬 합계와 검색 시간 (BENCH_ELEMENTS개)
+  init(&ull);
+  for (int i = 0; i < BENCH_ELEMENTS; i++)
+  {
+    append(&ull, i % 1000);
+  }
+  for (int threads = 1; threads <= 8; threads *= 2)
+  {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    long long total = list_reduce(&ull, reduce_sum, 0, threads);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double reduce_time = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int found = list_find_any(&ull, -1, threads); // 없는 값: 전체 순회
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double find_time = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("%d개, 스레드 %d: 합계 %.3f초 (%lld), 검색 %.3f초 (%d)\n",
+           BENCH_ELEMENTS, threads, reduce_time, total, find_time, found);
+  }
+  free_list(&ull);
+  return 0;
+}
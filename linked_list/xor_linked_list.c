@@ -0,0 +1,437 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+// XOR 연결 리스트의 노드를 나타내는 구조체
+// 이전/다음 포인터 두 개 대신 (prev ^ next) 하나만 저장해 노드를 24바이트에서 16바이트로 줄인다.
+// 한쪽 이웃의 주소를 알고 있어야 다른 쪽 이웃을 구할 수 있으므로, 순회는 항상 양 끝(head/tail)에서 시작한다.
+typedef struct Node
+{
+  int data;       // 노드에 저장된 데이터
+  uintptr_t link; // 이전 노드 주소 ^ 다음 노드 주소 (끝 쪽 이웃은 NULL로 취급)
+} Node;
+
+// 슬랩 하나에 담기는 노드 수
+#define SLAB_NODES 256
+
+// 노드 풀의 슬랩: 여러 노드를 한 번의 malloc으로 할당한 블록
+typedef struct Slab
+{
+  struct Slab *next; // 다음 슬랩
+  Node nodes[];      // 노드 배열
+} Slab;
+
+// 노드 풀: 슬랩 목록과 반환된 노드를 재사용하기 위한 free list
+typedef struct NodePool
+{
+  Slab *slabs;      // 할당된 슬랩 목록
+  Node *free_nodes; // 재사용 가능한 노드 목록 (link에 다음 노드 주소를 저장)
+  size_t bytes;     // 슬랩에 할당한 전체 바이트 수
+} NodePool;
+
+// XOR 연결 리스트를 나타내는 구조체
+typedef struct XorLinkedList
+{
+  Node *head;    // 리스트의 시작(head)
+  Node *tail;    // 리스트의 끝(tail)
+  int size;      // 노드 수
+  NodePool pool; // 노드를 할당하는 리스트 전용 노드 풀
+} XorLinkedList;
+
+// 두 주소를 XOR하는 함수
+uintptr_t xor_ptr(Node *a, Node *b)
+{
+  return (uintptr_t)a ^ (uintptr_t)b;
+}
+
+// node의 한쪽 이웃(from)을 알 때 반대쪽 이웃을 구하는 함수
+Node *step(Node *node, Node *from)
+{
+  return (Node *)(node->link ^ (uintptr_t)from);
+}
+
+// 노드 풀 초기화 함수
+void pool_init(NodePool *pool)
+{
+  pool->slabs = NULL;
+  pool->free_nodes = NULL;
+  pool->bytes = 0;
+}
+
+// 풀에서 노드 하나를 꺼내는 함수 (free list가 비면 새 슬랩을 할당)
+Node *pool_alloc(NodePool *pool)
+{
+  if (!pool->free_nodes)
+  {
+    size_t bytes = sizeof(Slab) + SLAB_NODES * sizeof(Node);
+    Slab *slab = (Slab *)malloc(bytes);
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->bytes += bytes;
+    for (int i = 0; i < SLAB_NODES - 1; i++)
+    {
+      slab->nodes[i].link = (uintptr_t)&slab->nodes[i + 1];
+    }
+    slab->nodes[SLAB_NODES - 1].link = 0;
+    pool->free_nodes = &slab->nodes[0];
+  }
+
+  Node *node = pool->free_nodes;
+  pool->free_nodes = (Node *)node->link;
+  return node;
+}
+
+// 노드를 풀의 free list로 반환하는 함수 (free를 호출하지 않음)
+void pool_free(NodePool *pool, Node *node)
+{
+  node->link = (uintptr_t)pool->free_nodes;
+  pool->free_nodes = node;
+}
+
+// 풀의 모든 슬랩을 해제하는 함수 (노드 수가 아니라 슬랩 수만큼만 반복)
+void pool_destroy(NodePool *pool)
+{
+  Slab *slab = pool->slabs;
+  Slab *next;
+  while (slab)
+  {
+    next = slab->next;
+    free(slab);
+    slab = next;
+  }
+  pool_init(pool);
+}
+
+// 리스트 초기화 함수
+void init(XorLinkedList *list)
+{
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  pool_init(&list->pool);
+}
+
+// 리스트가 비어 있는지 확인하는 함수
+int is_empty(XorLinkedList *list)
+{
+  return list->head == NULL;
+}
+
+// 리스트의 끝에 새 노드를 추가하는 함수 (O(1))
+void append(XorLinkedList *list, int data)
+{
+  Node *new_node = pool_alloc(&list->pool);
+  new_node->data = data;
+  new_node->link = xor_ptr(list->tail, NULL); // 이전 = tail, 다음 = 없음
+
+  if (is_empty(list))
+  {
+    list->head = new_node;
+  }
+  else
+  {
+    list->tail->link ^= (uintptr_t)new_node; // tail의 다음이 NULL에서 new_node로 바뀜
+  }
+  list->tail = new_node;
+  list->size++;
+}
+
+// 리스트의 시작에 새 노드를 추가하는 함수 (O(1))
+void prepend(XorLinkedList *list, int data)
+{
+  Node *new_node = pool_alloc(&list->pool);
+  new_node->data = data;
+  new_node->link = xor_ptr(NULL, list->head); // 이전 = 없음, 다음 = head
+
+  if (is_empty(list))
+  {
+    list->tail = new_node;
+  }
+  else
+  {
+    list->head->link ^= (uintptr_t)new_node; // head의 이전이 NULL에서 new_node로 바뀜
+  }
+  list->head = new_node;
+  list->size++;
+}
+
+// 지정된 데이터를 가진 첫 번째 노드를 삭제하는 함수
+void delete(XorLinkedList *list, int data)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다. 삭제할 수 없습니다.\n");
+    return;
+  }
+
+  Node *prev = NULL;
+  Node *current = list->head;
+  while (current && current->data != data)
+  {
+    Node *next = step(current, prev);
+    prev = current;
+    current = next;
+  }
+  if (!current)
+  {
+    printf("리스트에 해당 데이터가 없습니다.\n");
+    return;
+  }
+
+  // 양쪽 이웃의 link에서 current를 빼고 서로를 넣음
+  Node *next = step(current, prev);
+  if (prev)
+  {
+    prev->link ^= xor_ptr(current, next);
+  }
+  else
+  {
+    list->head = next;
+  }
+  if (next)
+  {
+    next->link ^= xor_ptr(current, prev);
+  }
+  else
+  {
+    list->tail = prev;
+  }
+  pool_free(&list->pool, current);
+  list->size--;
+}
+
+// 지정된 데이터를 가진 노드를 검색하는 함수
+int search(XorLinkedList *list, int data)
+{
+  Node *prev = NULL;
+  Node *current = list->head;
+  while (current)
+  {
+    if (current->data == data)
+    {
+      return 1;
+    }
+    Node *next = step(current, prev);
+    prev = current;
+    current = next;
+  }
+  return 0;
+}
+
+// 리스트의 내용을 출력하는 함수 (head -> tail)
+void show(XorLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  Node *prev = NULL;
+  Node *current = list->head;
+  while (current)
+  {
+    printf("%d <-> ", current->data);
+    Node *next = step(current, prev);
+    prev = current;
+    current = next;
+  }
+  printf("NULL\n");
+}
+
+// 리스트의 내용을 거꾸로 출력하는 함수 (tail -> head, 같은 link로 반대 방향 순회)
+void show_reverse(XorLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    printf("리스트가 비어 있습니다.\n");
+    return;
+  }
+
+  Node *next = NULL;
+  Node *current = list->tail;
+  while (current)
+  {
+    printf("%d <-> ", current->data);
+    Node *prev = step(current, next);
+    next = current;
+    current = prev;
+  }
+  printf("NULL\n");
+}
+
+// 리스트를 뒤집는 함수 (O(1))
+// link는 prev ^ next라 방향과 무관하므로 head와 tail만 바꾸면 된다.
+void reverse(XorLinkedList *list)
+{
+  Node *temp = list->head;
+  list->head = list->tail;
+  list->tail = temp;
+}
+
+// 리스트의 노드 수를 반환하는 함수
+int length(XorLinkedList *list)
+{
+  return list->size;
+}
+
+// 리스트에서 N번째 노드 데이터를 찾는 함수 (head와 tail 중 가까운 쪽에서 출발)
+int get_nth(XorLinkedList *list, int n)
+{
+  if (n < 0 || n >= list->size)
+  {
+    printf("인덱스가 범위를 벗어났습니다.\n");
+    return -1;
+  }
+
+  Node *from = NULL;
+  Node *current = list->head;
+  int steps = n;
+  if (list->size - 1 - n < n)
+  {
+    current = list->tail;
+    steps = list->size - 1 - n;
+  }
+  while (steps-- > 0)
+  {
+    Node *next = step(current, from);
+    from = current;
+    current = next;
+  }
+  return current->data;
+}
+
+// 리스트의 중간 노드를 찾는 함수
+int find_middle(XorLinkedList *list)
+{
+  if (is_empty(list))
+  {
+    return -1;
+  }
+  return get_nth(list, list->size / 2);
+}
+
+// 메모리 해제 함수 (O(slabs))
+void free_list(XorLinkedList *list)
+{
+  pool_destroy(&list->pool);
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+}
+
+// 비교용: 포인터 두 개를 가진 기존 이중 연결 리스트의 노드
+typedef struct DoublyNode
+{
+  int data;
+  struct DoublyNode *next;
+  struct DoublyNode *prev;
+} DoublyNode;
+
+typedef struct DoublySlab
+{
+  struct DoublySlab *next;
+  DoublyNode nodes[];
+} DoublySlab;
+
+// 사용 예제
+int main()
+{
+  XorLinkedList xll;
+  init(&xll);
+  append(&xll, 10);
+  append(&xll, 20);
+  append(&xll, 30);
+  show(&xll);
+  prepend(&xll, 5);
+  show(&xll);
+  delete (&xll, 20);
+  show(&xll);
+  show_reverse(&xll);
+  printf("10 검색: %d\n", search(&xll, 10));
+  printf("40 검색: %d\n", search(&xll, 40));
+  printf("리스트 길이: %d\n", length(&xll));
+  reverse(&xll);
+  show(&xll);
+  printf("중간 노드: %d\n", find_middle(&xll));
+  printf("2번째 노드: %d\n", get_nth(&xll, 2));
+  free_list(&xll);
+
+  // 메모리와 순회 속도 비교 (두 리스트 모두 노드를 순서대로 연속 배치)
+  int n = 10000000;
+  init(&xll);
+  for (int i = 0; i < n; i++)
+  {
+    append(&xll, i);
+  }
+  size_t doubly_bytes = 0;
+  DoublyNode *dhead = NULL;
+  DoublyNode *dtail = NULL;
+  DoublySlab *dslabs = NULL; // 같은 수의 노드를 담는 슬랩으로 할당해 조건을 맞춤
+  for (int i = 0; i < n; i += SLAB_NODES)
+  {
+    size_t bytes = sizeof(DoublySlab) + SLAB_NODES * sizeof(DoublyNode);
+    DoublySlab *slab = (DoublySlab *)malloc(bytes);
+    slab->next = dslabs;
+    dslabs = slab;
+    doubly_bytes += bytes;
+    for (int k = 0; k < SLAB_NODES && i + k < n; k++)
+    {
+      DoublyNode *node = &slab->nodes[k];
+      node->data = i + k;
+      node->next = NULL;
+      node->prev = dtail;
+      if (dtail)
+      {
+        dtail->next = node;
+      }
+      else
+      {
+        dhead = node;
+      }
+      dtail = node;
+    }
+  }
+
+  int scans = 5;
+  long long sum = 0;
+  clock_t start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    Node *prev = NULL;
+    Node *current = xll.head;
+    while (current)
+    {
+      sum += current->data;
+      Node *next = step(current, prev);
+      prev = current;
+      current = next;
+    }
+  }
+  double xor_time = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  start = clock();
+  for (int s = 0; s < scans; s++)
+  {
+    for (DoublyNode *current = dhead; current; current = current->next)
+    {
+      sum -= current->data;
+    }
+  }
+  double doubly_time = (double)(clock() - start) / CLOCKS_PER_SEC / scans;
+
+  printf("%d개: XOR 노드 %zu바이트, 메모리 %.1fMB, 순회 %.4f초\n",
+         n, sizeof(Node), xll.pool.bytes / 1048576.0, xor_time);
+  printf("%d개: 이중 노드 %zu바이트, 메모리 %.1fMB, 순회 %.4f초 (합계 차이 %lld)\n",
+         n, sizeof(DoublyNode), doubly_bytes / 1048576.0, doubly_time, sum);
+
+  free_list(&xll);
+  while (dslabs)
+  {
+    DoublySlab *next = dslabs->next;
+    free(dslabs);
+    dslabs = next;
+  }
+  return 0;
+}